@@ -0,0 +1,32 @@
+#version 330 core
+
+// background.c defines BACKGROUND_COUNT, the number of layers in use
+#ifndef BACKGROUND_COUNT
+#define BACKGROUND_COUNT 1
+#endif
+
+in vec2 v_texcoord[BACKGROUND_COUNT];
+
+out vec4 FragColor;
+
+uniform sampler2D u_textures[BACKGROUND_COUNT];
+
+vec3 over(vec3 color, vec4 texel) {
+    return mix(color, texel.rgb, texel.a);
+}
+
+void main() {
+    // layers are composited back to front, the first one is opaque
+    vec3 color = texture(u_textures[0], v_texcoord[0]).rgb;
+#if BACKGROUND_COUNT > 1
+    color = over(color, texture(u_textures[1], v_texcoord[1]));
+#endif
+#if BACKGROUND_COUNT > 2
+    color = over(color, texture(u_textures[2], v_texcoord[2]));
+#endif
+#if BACKGROUND_COUNT > 3
+    color = over(color, texture(u_textures[3], v_texcoord[3]));
+#endif
+
+    FragColor = vec4(color, 1.0f);
+}
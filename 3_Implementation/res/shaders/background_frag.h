@@ -0,0 +1,44 @@
+// THIS FILE WAS AUTOGENERATED BY:
+// python3 scripts/res2header.py res/shaders/background_frag.glsl res/shaders/background_frag.h
+#ifndef SHADERS_BACKGROUND_FRAG_H_INCLUDED
+#define SHADERS_BACKGROUND_FRAG_H_INCLUDED
+
+#include "shader.h"
+
+static const char SHADER_BACKGROUND_FRAG_PATH[] = "res/shaders/background_frag.glsl";
+static const char SHADER_BACKGROUND_FRAG_SOURCE[] = 
+    "#version 330 core\n"
+    "\n"
+    "// background.c defines BACKGROUND_COUNT, the number of layers in use\n"
+    "#ifndef BACKGROUND_COUNT\n"
+    "#define BACKGROUND_COUNT 1\n"
+    "#endif\n"
+    "\n"
+    "in vec2 v_texcoord[BACKGROUND_COUNT];\n"
+    "\n"
+    "out vec4 FragColor;\n"
+    "\n"
+    "uniform sampler2D u_textures[BACKGROUND_COUNT];\n"
+    "\n"
+    "vec3 over(vec3 color, vec4 texel) {\n"
+    "    return mix(color, texel.rgb, texel.a);\n"
+    "}\n"
+    "\n"
+    "void main() {\n"
+    "    // layers are composited back to front, the first one is opaque\n"
+    "    vec3 color = texture(u_textures[0], v_texcoord[0]).rgb;\n"
+    "#if BACKGROUND_COUNT > 1\n"
+    "    color = over(color, texture(u_textures[1], v_texcoord[1]));\n"
+    "#endif\n"
+    "#if BACKGROUND_COUNT > 2\n"
+    "    color = over(color, texture(u_textures[2], v_texcoord[2]));\n"
+    "#endif\n"
+    "#if BACKGROUND_COUNT > 3\n"
+    "    color = over(color, texture(u_textures[3], v_texcoord[3]));\n"
+    "#endif\n"
+    "\n"
+    "    FragColor = vec4(color, 1.0f);\n"
+    "}\n"
+;
+
+#endif
@@ -0,0 +1,37 @@
+#version 330 core
+
+// background.c defines BACKGROUND_COUNT, the number of layers in use
+#ifndef BACKGROUND_COUNT
+#define BACKGROUND_COUNT 1
+#endif
+
+uniform float u_layer;
+uniform vec2 u_view;                    // half width, half height of the visible world
+uniform vec3 u_tile[BACKGROUND_COUNT];  // tile width, tile height, scroll rate
+
+layout(std140) uniform Frame {
+    mat4 u_projection;
+    float u_time;
+    float u_scroll;
+};
+
+out vec2 v_texcoord[BACKGROUND_COUNT];
+
+// two CCW triangles covering the whole view
+const vec2 corners[6] = vec2[6](
+    vec2( 1.0f,  1.0f), vec2(-1.0f,  1.0f), vec2(-1.0f, -1.0f),
+    vec2( 1.0f,  1.0f), vec2(-1.0f, -1.0f), vec2( 1.0f, -1.0f)
+);
+
+void main() {
+    vec2 world = corners[gl_VertexID] * u_view;
+
+    // tiles are centered on the origin and slide left as the view scrolls,
+    // the texture's GL_REPEAT wrap mode does the tiling
+    for (int i = 0; i < BACKGROUND_COUNT; i++) {
+        vec2 scrolled = world + vec2(u_scroll * u_tile[i].z, 0.0f);
+        v_texcoord[i] = scrolled / u_tile[i].xy + 0.5f;
+    }
+
+    gl_Position = u_projection * vec4(world, u_layer, 1.0f);
+}
@@ -0,0 +1,49 @@
+// THIS FILE WAS AUTOGENERATED BY:
+// python3 scripts/res2header.py res/shaders/background_vert.glsl res/shaders/background_vert.h
+#ifndef SHADERS_BACKGROUND_VERT_H_INCLUDED
+#define SHADERS_BACKGROUND_VERT_H_INCLUDED
+
+#include "shader.h"
+
+static const char SHADER_BACKGROUND_VERT_PATH[] = "res/shaders/background_vert.glsl";
+static const char SHADER_BACKGROUND_VERT_SOURCE[] = 
+    "#version 330 core\n"
+    "\n"
+    "// background.c defines BACKGROUND_COUNT, the number of layers in use\n"
+    "#ifndef BACKGROUND_COUNT\n"
+    "#define BACKGROUND_COUNT 1\n"
+    "#endif\n"
+    "\n"
+    "uniform float u_layer;\n"
+    "uniform vec2 u_view;                    // half width, half height of the visible world\n"
+    "uniform vec3 u_tile[BACKGROUND_COUNT];  // tile width, tile height, scroll rate\n"
+    "\n"
+    "layout(std140) uniform Frame {\n"
+    "    mat4 u_projection;\n"
+    "    float u_time;\n"
+    "    float u_scroll;\n"
+    "};\n"
+    "\n"
+    "out vec2 v_texcoord[BACKGROUND_COUNT];\n"
+    "\n"
+    "// two CCW triangles covering the whole view\n"
+    "const vec2 corners[6] = vec2[6](\n"
+    "    vec2( 1.0f,  1.0f), vec2(-1.0f,  1.0f), vec2(-1.0f, -1.0f),\n"
+    "    vec2( 1.0f,  1.0f), vec2(-1.0f, -1.0f), vec2( 1.0f, -1.0f)\n"
+    ");\n"
+    "\n"
+    "void main() {\n"
+    "    vec2 world = corners[gl_VertexID] * u_view;\n"
+    "\n"
+    "    // tiles are centered on the origin and slide left as the view scrolls,\n"
+    "    // the texture's GL_REPEAT wrap mode does the tiling\n"
+    "    for (int i = 0; i < BACKGROUND_COUNT; i++) {\n"
+    "        vec2 scrolled = world + vec2(u_scroll * u_tile[i].z, 0.0f);\n"
+    "        v_texcoord[i] = scrolled / u_tile[i].xy + 0.5f;\n"
+    "    }\n"
+    "\n"
+    "    gl_Position = u_projection * vec4(world, u_layer, 1.0f);\n"
+    "}\n"
+;
+
+#endif
@@ -1,7 +1,15 @@
 #version 330 core
 
+in vec2 v_cell;
+flat in uint v_mask;
+
 out vec4 FragColor;
 
 void main() {
+    // each nibble of the mask is a row from top to bottom, high bit left
+    ivec2 cell = clamp(ivec2(v_cell), 0, 3);
+    uint bit = uint(15 - (cell.y * 4 + cell.x));
+    if (((v_mask >> bit) & 1u) == 0u) discard;
+
     FragColor = vec4(1.0f, 1.0f, 1.0f, 1.0f);
 }
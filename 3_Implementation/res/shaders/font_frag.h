@@ -9,9 +9,17 @@ static const char SHADER_FONT_FRAG_PATH[] = "res/shaders/font_frag.glsl";
 static const char SHADER_FONT_FRAG_SOURCE[] = 
     "#version 330 core\n"
     "\n"
+    "in vec2 v_cell;\n"
+    "flat in uint v_mask;\n"
+    "\n"
     "out vec4 FragColor;\n"
     "\n"
     "void main() {\n"
+    "    // each nibble of the mask is a row from top to bottom, high bit left\n"
+    "    ivec2 cell = clamp(ivec2(v_cell), 0, 3);\n"
+    "    uint bit = uint(15 - (cell.y * 4 + cell.x));\n"
+    "    if (((v_mask >> bit) & 1u) == 0u) discard;\n"
+    "\n"
     "    FragColor = vec4(1.0f, 1.0f, 1.0f, 1.0f);\n"
     "}\n"
 ;
@@ -1,11 +1,32 @@
 #version 330 core
 
-layout(location = 0) in vec2 a_position;
+// one instance per character: x, y and the 16-bit glyph mask
+layout(location = 0) in vec3 a_glyph;
 
 uniform float u_layer;
 uniform mat4 u_model;
-uniform mat4 u_projection;
+
+layout(std140) uniform Frame {
+    mat4 u_projection;
+    float u_time;
+    float u_scroll;
+};
+
+out vec2 v_cell;
+flat out uint v_mask;
+
+// two CCW triangles covering the character, centered on its position
+const vec2 corners[6] = vec2[6](
+    vec2( 0.5f,  0.5f), vec2(-0.5f,  0.5f), vec2(-0.5f, -0.5f),
+    vec2( 0.5f,  0.5f), vec2(-0.5f, -0.5f), vec2( 0.5f, -0.5f)
+);
 
 void main() {
-    gl_Position = u_projection * u_model * vec4(a_position, u_layer, 1.0f);
+    vec2 corner = corners[gl_VertexID];
+
+    // pixel grid of the glyph, (0, 0) top left to (4, 4) bottom right
+    v_cell = vec2(corner.x + 0.5f, 0.5f - corner.y) * 4.0f;
+    v_mask = uint(a_glyph.z);
+
+    gl_Position = u_projection * u_model * vec4(a_glyph.xy + corner, u_layer, 1.0f);
 }
@@ -9,14 +9,35 @@ static const char SHADER_FONT_VERT_PATH[] = "res/shaders/font_vert.glsl";
 static const char SHADER_FONT_VERT_SOURCE[] = 
     "#version 330 core\n"
     "\n"
-    "layout(location = 0) in vec2 a_position;\n"
+    "// one instance per character: x, y and the 16-bit glyph mask\n"
+    "layout(location = 0) in vec3 a_glyph;\n"
     "\n"
     "uniform float u_layer;\n"
     "uniform mat4 u_model;\n"
-    "uniform mat4 u_projection;\n"
+    "\n"
+    "layout(std140) uniform Frame {\n"
+    "    mat4 u_projection;\n"
+    "    float u_time;\n"
+    "    float u_scroll;\n"
+    "};\n"
+    "\n"
+    "out vec2 v_cell;\n"
+    "flat out uint v_mask;\n"
+    "\n"
+    "// two CCW triangles covering the character, centered on its position\n"
+    "const vec2 corners[6] = vec2[6](\n"
+    "    vec2( 0.5f,  0.5f), vec2(-0.5f,  0.5f), vec2(-0.5f, -0.5f),\n"
+    "    vec2( 0.5f,  0.5f), vec2(-0.5f, -0.5f), vec2( 0.5f, -0.5f)\n"
+    ");\n"
     "\n"
     "void main() {\n"
-    "    gl_Position = u_projection * u_model * vec4(a_position, u_layer, 1.0f);\n"
+    "    vec2 corner = corners[gl_VertexID];\n"
+    "\n"
+    "    // pixel grid of the glyph, (0, 0) top left to (4, 4) bottom right\n"
+    "    v_cell = vec2(corner.x + 0.5f, 0.5f - corner.y) * 4.0f;\n"
+    "    v_mask = uint(a_glyph.z);\n"
+    "\n"
+    "    gl_Position = u_projection * u_model * vec4(a_glyph.xy + corner, u_layer, 1.0f);\n"
     "}\n"
 ;
 
@@ -1,14 +1,30 @@
 #version 330 core
 
+// per vertex (the unit sprite quad)
 layout(location = 0) in vec3 a_position;
 layout(location = 1) in vec2 a_texcoord;
 
+// per instance
+layout(location = 2) in vec3 a_offset;     // x, y, layer
+layout(location = 3) in vec3 a_transform;  // rotation (radians), scale x, scale y
+layout(location = 4) in vec4 a_region;     // texcoord rect: u0, v0, u1, v1
+
 out vec2 v_texcoord;
 
-uniform mat4 u_model;
-uniform mat4 u_projection;
+layout(std140) uniform Frame {
+    mat4 u_projection;
+    float u_time;
+    float u_scroll;
+};
 
 void main() {
-    v_texcoord = a_texcoord;
-    gl_Position = u_projection * u_model * vec4(a_position, 1.0f);
+    v_texcoord = mix(a_region.xy, a_region.zw, a_texcoord);
+
+    // same as translate * rotate_Z * scale applied to the quad
+    vec2 scaled = a_position.xy * a_transform.yz;
+    float c = cos(a_transform.x);
+    float s = sin(a_transform.x);
+    vec2 rotated = vec2(c * scaled.x - s * scaled.y, s * scaled.x + c * scaled.y);
+
+    gl_Position = u_projection * vec4(rotated + a_offset.xy, a_position.z + a_offset.z, 1.0f);
 }
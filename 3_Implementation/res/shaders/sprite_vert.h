@@ -9,17 +9,33 @@ static const char SHADER_SPRITE_VERT_PATH[] = "res/shaders/sprite_vert.glsl";
 static const char SHADER_SPRITE_VERT_SOURCE[] = 
     "#version 330 core\n"
     "\n"
+    "// per vertex (the unit sprite quad)\n"
     "layout(location = 0) in vec3 a_position;\n"
     "layout(location = 1) in vec2 a_texcoord;\n"
     "\n"
+    "// per instance\n"
+    "layout(location = 2) in vec3 a_offset;     // x, y, layer\n"
+    "layout(location = 3) in vec3 a_transform;  // rotation (radians), scale x, scale y\n"
+    "layout(location = 4) in vec4 a_region;     // texcoord rect: u0, v0, u1, v1\n"
+    "\n"
     "out vec2 v_texcoord;\n"
     "\n"
-    "uniform mat4 u_model;\n"
-    "uniform mat4 u_projection;\n"
+    "layout(std140) uniform Frame {\n"
+    "    mat4 u_projection;\n"
+    "    float u_time;\n"
+    "    float u_scroll;\n"
+    "};\n"
     "\n"
     "void main() {\n"
-    "    v_texcoord = a_texcoord;\n"
-    "    gl_Position = u_projection * u_model * vec4(a_position, 1.0f);\n"
+    "    v_texcoord = mix(a_region.xy, a_region.zw, a_texcoord);\n"
+    "\n"
+    "    // same as translate * rotate_Z * scale applied to the quad\n"
+    "    vec2 scaled = a_position.xy * a_transform.yz;\n"
+    "    float c = cos(a_transform.x);\n"
+    "    float s = sin(a_transform.x);\n"
+    "    vec2 rotated = vec2(c * scaled.x - s * scaled.y, s * scaled.x + c * scaled.y);\n"
+    "\n"
+    "    gl_Position = u_projection * vec4(rotated + a_offset.xy, a_position.z + a_offset.z, 1.0f);\n"
     "}\n"
 ;
 
@@ -1,3953 +0,0 @@
-// THIS FILE WAS AUTOGENERATED BY:
-// python3 scripts/res2header.py res/textures/bird.png res/textures/bird.h
-#ifndef TEXTURES_BIRD_H_INCLUDED
-#define TEXTURES_BIRD_H_INCLUDED
-
-#include "texture.h"
-
-static const char TEXTURE_BIRD_PATH[] = "res/textures/bird.png";
-static const int TEXTURE_BIRD_FORMAT = TEXTURE_FORMAT_RGBA;
-static const long TEXTURE_BIRD_WIDTH = 125;
-static const long TEXTURE_BIRD_HEIGHT = 126;
-static const unsigned char TEXTURE_BIRD_PIXELS[] = {
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x3c, 0x46, 0xc1,
-    0x53, 0x31, 0x46, 0xcd, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb,
-    0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x54, 0x32, 0x46, 0xcb,
-    0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb,
-    0x53, 0x32, 0x46, 0xcb, 0x53, 0x33, 0x46, 0xcb, 0x53, 0x33, 0x46, 0xcb, 0x53, 0x33, 0x46, 0xcb,
-    0x53, 0x33, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb,
-    0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x33, 0x46, 0xcb,
-    0x53, 0x33, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb,
-    0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb, 0x53, 0x32, 0x46, 0xcb,
-    0x54, 0x32, 0x45, 0xcb, 0x53, 0x32, 0x45, 0xcb, 0x53, 0x32, 0x45, 0xcb, 0x54, 0x2c, 0x45, 0x8b,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x52, 0x41, 0x47, 0xbd, 0x53, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x33, 0x47, 0x87, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x52, 0x41, 0x47, 0xbd, 0x53, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x33, 0x47, 0x87, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x41, 0x47, 0xbd, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x33, 0x47, 0x87, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x41, 0x47, 0xbd,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x33, 0x47, 0x87,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x52, 0x41, 0x47, 0xbd, 0x53, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x33, 0x47, 0x87, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x52, 0x3f, 0x47, 0x94, 0x54, 0x38, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff, 0x53, 0x39, 0x46, 0xff,
-    0x53, 0x39, 0x46, 0xff, 0x54, 0x35, 0x45, 0x86, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x48, 0x7b, 0x51, 0x44, 0x47, 0x7b,
-    0x51, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b,
-    0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b,
-    0x51, 0x44, 0x47, 0x7b, 0x57, 0x47, 0x47, 0x7a, 0xc4, 0x95, 0x34, 0x9c, 0xb6, 0x8b, 0x37, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x36, 0xff,
-    0xb5, 0x8a, 0x36, 0xff, 0xb5, 0x8a, 0x37, 0xff, 0xb6, 0x8a, 0x35, 0x86, 0xff, 0xff, 0xff, 0x00,
-    0x51, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b,
-    0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b,
-    0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b,
-    0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b,
-    0x53, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b,
-    0x51, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b,
-    0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b,
-    0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b, 0x51, 0x44, 0x47, 0x7b, 0x53, 0x45, 0x47, 0x7b,
-    0x53, 0x45, 0x47, 0x7b, 0x53, 0x45, 0x47, 0x7b, 0x53, 0x44, 0x47, 0x7b, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x42, 0x47, 0x7d, 0x53, 0x35, 0x46, 0xc9, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x52, 0x36, 0x46, 0xff, 0x5a, 0x3a, 0x44, 0xff, 0xed, 0xb4, 0x2c, 0xff,
-    0xfb, 0xc4, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xfb, 0xc3, 0x2c, 0xff, 0xfe, 0xc5, 0x2a, 0x8d,
-    0x4b, 0x32, 0x47, 0x87, 0x53, 0x37, 0x46, 0xc7, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x5a, 0x3b, 0x44, 0xff,
-    0xec, 0xb3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xfc, 0xc5, 0x2a, 0xaa, 0x4a, 0x32, 0x47, 0xaa, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x44, 0x47, 0x7b, 0x53, 0x36, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x5a, 0x3b, 0x44, 0xff, 0xec, 0xb3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xfc, 0xc5, 0x2a, 0xaa, 0x4a, 0x32, 0x47, 0xaa, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x37, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x42, 0x47, 0x7d,
-    0x53, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x5a, 0x3b, 0x44, 0xff, 0xec, 0xb3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xfc, 0xc5, 0x2a, 0xaa, 0x4a, 0x32, 0x47, 0xaa,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x37, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x42, 0x47, 0x7d, 0x53, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x5a, 0x3b, 0x44, 0xff, 0xec, 0xb3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xfc, 0xc5, 0x2a, 0xaa,
-    0x4a, 0x32, 0x47, 0xaa, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x37, 0x46, 0xc7,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x51, 0x42, 0x47, 0x7d, 0x52, 0x36, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x59, 0x3b, 0x44, 0xff,
-    0xeb, 0xb3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xfc, 0xc5, 0x2a, 0xaa, 0x4a, 0x32, 0x47, 0xaa, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x76, 0x56, 0x42, 0x91, 0x83, 0x57, 0x40, 0xff,
-    0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff,
-    0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff,
-    0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff, 0x82, 0x58, 0x40, 0xff,
-    0x87, 0x5b, 0x3e, 0xff, 0xef, 0xb6, 0x2c, 0xff, 0xf9, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xe6, 0xb2, 0x2e, 0xff, 0xcc, 0x9b, 0x30, 0xff,
-    0xcd, 0x9c, 0x2f, 0xff, 0xcd, 0x9c, 0x2f, 0xff, 0xcd, 0x9c, 0x2f, 0xff, 0xcd, 0x9c, 0x2f, 0xff,
-    0xcd, 0x9c, 0x2f, 0xff, 0xcd, 0x94, 0x32, 0xc6, 0x89, 0x44, 0x49, 0xc6, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff, 0x83, 0x45, 0x49, 0xff,
-    0x83, 0x45, 0x49, 0xff, 0x84, 0x44, 0x49, 0xb9, 0x99, 0x4a, 0x4b, 0x64, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x36, 0x46, 0xc7, 0x53, 0x35, 0x46, 0xc9, 0x53, 0x36, 0x46, 0xc7, 0x53, 0x36, 0x46, 0xc7,
-    0x53, 0x36, 0x46, 0xc7, 0x53, 0x36, 0x46, 0xc7, 0x51, 0x34, 0x46, 0xc9, 0xb4, 0x87, 0x37, 0xc7,
-    0xf9, 0xc1, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff,
-    0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff,
-    0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xc0, 0x2c, 0xff,
-    0xf8, 0xc0, 0x2c, 0xff, 0xf8, 0xbf, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xb2, 0x87, 0x38, 0xff,
-    0x52, 0x36, 0x45, 0xff, 0x57, 0x3a, 0x45, 0xff, 0x57, 0x3a, 0x45, 0xff, 0x57, 0x3a, 0x45, 0xff,
-    0x57, 0x3a, 0x45, 0xff, 0x57, 0x3a, 0x45, 0xff, 0x7c, 0x44, 0x48, 0xff, 0xeb, 0x63, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff,
-    0xfb, 0x67, 0x4c, 0xff, 0xfb, 0x67, 0x4c, 0xff, 0xfc, 0x68, 0x4c, 0xff, 0xd0, 0x5b, 0x4c, 0xb1,
-    0x4d, 0x35, 0x46, 0xc9, 0x53, 0x36, 0x46, 0xc7, 0x53, 0x36, 0x46, 0xc7, 0x53, 0x36, 0x46, 0xc7,
-    0x53, 0x36, 0x46, 0xc7, 0x53, 0x35, 0x46, 0xc9, 0x53, 0x2c, 0x45, 0x8b, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x53, 0x38, 0x47, 0xc5, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0xb4, 0x89, 0x37, 0xff, 0xfb, 0xc3, 0x2b, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xb0, 0x86, 0x39, 0xff, 0x4d, 0x33, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x79, 0x42, 0x49, 0xff,
-    0xed, 0x63, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xd2, 0x5b, 0x4c, 0xff, 0x4d, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x2f, 0x45, 0x8a,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x39, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0xb4, 0x89, 0x37, 0xff, 0xfb, 0xc3, 0x2b, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xaf, 0x86, 0x39, 0xff, 0x4d, 0x33, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x79, 0x42, 0x49, 0xff, 0xed, 0x63, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xd2, 0x5b, 0x4c, 0xff, 0x4d, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x2f, 0x45, 0x8a, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x39, 0x46, 0xc5,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0xb4, 0x89, 0x37, 0xff, 0xfb, 0xc3, 0x2b, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xaf, 0x86, 0x39, 0xff, 0x4d, 0x33, 0x47, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x79, 0x42, 0x49, 0xff, 0xed, 0x63, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xd2, 0x5b, 0x4c, 0xff, 0x4d, 0x37, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x30, 0x45, 0x89, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x39, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0xb4, 0x89, 0x37, 0xff,
-    0xfb, 0xc3, 0x2b, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xaf, 0x86, 0x39, 0xff,
-    0x4d, 0x33, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x79, 0x42, 0x49, 0xff, 0xed, 0x63, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xd2, 0x5b, 0x4c, 0xff,
-    0x4d, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x30, 0x45, 0x89, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x53, 0x39, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0xb5, 0x89, 0x37, 0xff, 0xfb, 0xc4, 0x2b, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xaf, 0x86, 0x39, 0xff, 0x4c, 0x33, 0x47, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x78, 0x42, 0x49, 0xff,
-    0xed, 0x63, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xd3, 0x5b, 0x4c, 0xff, 0x4d, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x30, 0x45, 0x89,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x39, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0xb3, 0x87, 0x37, 0xff, 0xf9, 0xc0, 0x2c, 0xff, 0xf7, 0xbe, 0x2d, 0xff,
-    0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff,
-    0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff,
-    0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf7, 0xbf, 0x2c, 0xff, 0xf7, 0xbe, 0x2d, 0xff,
-    0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff, 0xf7, 0xbe, 0x2d, 0xff,
-    0xf7, 0xbe, 0x2c, 0xff, 0xb1, 0x84, 0x39, 0xff, 0x55, 0x34, 0x47, 0xff, 0x5a, 0x39, 0x47, 0xff,
-    0x5a, 0x39, 0x47, 0xff, 0x5a, 0x39, 0x47, 0xff, 0x5a, 0x39, 0x47, 0xff, 0x59, 0x39, 0x46, 0xff,
-    0x7e, 0x43, 0x49, 0xff, 0xea, 0x62, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff, 0xf9, 0x67, 0x4c, 0xff,
-    0xfa, 0x67, 0x4c, 0xff, 0xd0, 0x5a, 0x4c, 0xff, 0x4d, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x30, 0x45, 0x89, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x39, 0x46, 0xc5,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x65, 0x44, 0x43, 0xff, 0x72, 0x4d, 0x42, 0xff,
-    0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff,
-    0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff,
-    0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff,
-    0x77, 0x4f, 0x40, 0xff, 0xed, 0xb4, 0x2c, 0xff, 0xf9, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xfc, 0xc3, 0x2b, 0xff, 0x8f, 0x60, 0x3e, 0xff,
-    0x71, 0x4b, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x42, 0xff,
-    0x72, 0x4c, 0x42, 0xff, 0x72, 0x4c, 0x41, 0xff, 0xa9, 0x56, 0x46, 0xff, 0xeb, 0x62, 0x4b, 0xff,
-    0xea, 0x61, 0x4b, 0xff, 0xea, 0x61, 0x4b, 0xff, 0xea, 0x61, 0x4b, 0xff, 0xea, 0x61, 0x4b, 0xff,
-    0xea, 0x61, 0x4b, 0xff, 0xd4, 0x5b, 0x4b, 0xff, 0x81, 0x43, 0x49, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff,
-    0x73, 0x40, 0x48, 0xff, 0x73, 0x40, 0x48, 0xff, 0x6b, 0x3d, 0x48, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x30, 0x45, 0x89, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x39, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x50, 0x36, 0x46, 0xff, 0x58, 0x39, 0x44, 0xff, 0xeb, 0xb3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xfc, 0xc3, 0x2b, 0xff,
-    0x75, 0x4e, 0x42, 0xff, 0x4f, 0x35, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x4f, 0x36, 0x46, 0xff, 0xa1, 0x4d, 0x48, 0xff,
-    0xff, 0x6a, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xdd, 0x5f, 0x4a, 0xff, 0x63, 0x3d, 0x47, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x30, 0x45, 0x89, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x53, 0x39, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x5a, 0x3b, 0x44, 0xff, 0xec, 0xb3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xfc, 0xc3, 0x2b, 0xff, 0x77, 0x4f, 0x42, 0xff, 0x51, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0xa1, 0x4e, 0x48, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xdc, 0x5e, 0x4a, 0xff,
-    0x65, 0x3d, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x30, 0x45, 0x89,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x39, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x5a, 0x3b, 0x44, 0xff,
-    0xec, 0xb3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xfc, 0xc3, 0x2b, 0xff, 0x77, 0x4f, 0x42, 0xff, 0x51, 0x37, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0xa1, 0x4e, 0x48, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xdc, 0x5e, 0x4a, 0xff, 0x65, 0x3d, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x30, 0x45, 0x89, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x39, 0x46, 0xc5,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x5a, 0x3b, 0x44, 0xff, 0xec, 0xb3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xfc, 0xc3, 0x2b, 0xff, 0x77, 0x4f, 0x42, 0xff,
-    0x51, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0xa1, 0x4e, 0x48, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xdc, 0x5e, 0x4a, 0xff, 0x65, 0x3d, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x2f, 0x45, 0x8a, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x39, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x5a, 0x3b, 0x44, 0xff, 0xec, 0xb3, 0x2c, 0xff, 0xfa, 0xc3, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xfc, 0xc3, 0x2b, 0xff,
-    0x77, 0x4f, 0x42, 0xff, 0x51, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0xa1, 0x4e, 0x48, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xdc, 0x5e, 0x4a, 0xff, 0x65, 0x3d, 0x47, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x2f, 0x45, 0x8a, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x51, 0x36, 0x46, 0xc7, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff,
-    0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff,
-    0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff,
-    0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff,
-    0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff, 0x51, 0x34, 0x46, 0xff,
-    0x51, 0x34, 0x46, 0xff, 0x50, 0x34, 0x46, 0xff, 0x58, 0x38, 0x44, 0xff, 0xeb, 0xb3, 0x2c, 0xff,
-    0xfa, 0xc3, 0x2c, 0xff, 0xfa, 0xc2, 0x2c, 0xff, 0xfa, 0xc2, 0x2c, 0xff, 0xfa, 0xc2, 0x2c, 0xff,
-    0xfa, 0xc2, 0x2c, 0xff, 0xfa, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff, 0xf9, 0xc2, 0x2c, 0xff,
-    0xfc, 0xc2, 0x2b, 0xff, 0x76, 0x4e, 0x41, 0xff, 0x4f, 0x34, 0x47, 0xff, 0x51, 0x35, 0x46, 0xff,
-    0x51, 0x35, 0x46, 0xff, 0x51, 0x35, 0x46, 0xff, 0x51, 0x35, 0x46, 0xff, 0x4f, 0x35, 0x46, 0xff,
-    0xa1, 0x4d, 0x48, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xdd, 0x5f, 0x4a, 0xff,
-    0x64, 0x3d, 0x47, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff,
-    0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x51, 0x38, 0x46, 0xff, 0x50, 0x2f, 0x45, 0x8a,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xab, 0x9d, 0x37, 0xc7, 0xaf, 0xa2, 0x37, 0xff,
-    0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff,
-    0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff,
-    0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff,
-    0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff,
-    0xaf, 0xa2, 0x37, 0xff, 0xaf, 0xa2, 0x37, 0xff, 0xae, 0xa2, 0x37, 0xff, 0xaf, 0xa0, 0x37, 0xff,
-    0xae, 0x83, 0x3c, 0xff, 0xa8, 0x7c, 0x3d, 0xff, 0xa9, 0x7d, 0x3d, 0xff, 0xa9, 0x7d, 0x3d, 0xff,
-    0xa9, 0x7d, 0x3d, 0xff, 0xa9, 0x7d, 0x3d, 0xff, 0xa8, 0x7c, 0x3d, 0xff, 0xd3, 0xaf, 0x32, 0xff,
-    0xfa, 0xdd, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff,
-    0xf9, 0xdc, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff,
-    0xf9, 0xdc, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff, 0xf9, 0xdc, 0x28, 0xff,
-    0xf9, 0xdc, 0x28, 0xff, 0xfb, 0xdc, 0x27, 0xff, 0xbf, 0xa9, 0x31, 0xff, 0xae, 0x9e, 0x34, 0xff,
-    0xaf, 0x9f, 0x34, 0xff, 0xaf, 0x9f, 0x34, 0xff, 0xaf, 0x9f, 0x34, 0xff, 0xaf, 0x9f, 0x34, 0xff,
-    0xae, 0x9e, 0x34, 0xff, 0xab, 0x7c, 0x3f, 0xff, 0xa9, 0x4d, 0x4c, 0xff, 0xaa, 0x50, 0x4b, 0xff,
-    0xaa, 0x50, 0x4b, 0xff, 0xaa, 0x50, 0x4b, 0xff, 0xaa, 0x50, 0x4b, 0xff, 0xaa, 0x50, 0x4b, 0xff,
-    0xad, 0x51, 0x4c, 0xff, 0xb0, 0x53, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff, 0xaf, 0x52, 0x49, 0xff,
-    0xaf, 0x53, 0x49, 0xa1, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x35, 0x46, 0xc9, 0x53, 0x37, 0x46, 0xc7, 0x53, 0x37, 0x46, 0xc7, 0x53, 0x37, 0x46, 0xc7,
-    0x53, 0x37, 0x46, 0xc7, 0x52, 0x35, 0x46, 0xc9, 0x5c, 0x40, 0x44, 0xbd, 0xf4, 0xf6, 0x2e, 0xcf,
-    0xfa, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff,
-    0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff,
-    0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff,
-    0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff,
-    0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xf9, 0xff, 0x2e, 0xff, 0xfa, 0xff, 0x2e, 0xff,
-    0xf7, 0xf8, 0x2f, 0xff, 0x6d, 0x56, 0x44, 0xff, 0x4d, 0x33, 0x46, 0xff, 0x50, 0x35, 0x46, 0xff,
-    0x50, 0x35, 0x46, 0xff, 0x50, 0x35, 0x46, 0xff, 0x50, 0x35, 0x46, 0xff, 0x4f, 0x35, 0x46, 0xff,
-    0xaa, 0x9b, 0x34, 0xff, 0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff,
-    0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff,
-    0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff,
-    0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff, 0xf9, 0xf2, 0x24, 0xff, 0xfa, 0xf2, 0x24, 0xff,
-    0xfa, 0xf2, 0x23, 0xff, 0xfa, 0xf2, 0x23, 0xff, 0xfa, 0xf2, 0x23, 0xff, 0xfa, 0xf2, 0x23, 0xff,
-    0xfa, 0xf2, 0x23, 0xff, 0xfa, 0xf3, 0x23, 0xff, 0xb0, 0xa1, 0x33, 0xff, 0x49, 0x30, 0x46, 0xff,
-    0x50, 0x37, 0x45, 0xff, 0x50, 0x37, 0x45, 0xff, 0x50, 0x37, 0x45, 0xff, 0x50, 0x37, 0x45, 0xff,
-    0x4f, 0x37, 0x45, 0xff, 0x77, 0x42, 0x48, 0xff, 0xed, 0x64, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff, 0xfe, 0x69, 0x4b, 0xff,
-    0xfe, 0x69, 0x4b, 0xff, 0xe7, 0x63, 0x4a, 0xb3, 0x70, 0x3f, 0x47, 0xbf, 0x53, 0x36, 0x46, 0xc7,
-    0x53, 0x36, 0x46, 0xc7, 0x53, 0x36, 0x45, 0xc7, 0x53, 0x35, 0x45, 0xc9, 0x53, 0x35, 0x45, 0xc9,
-    0x53, 0x33, 0x45, 0xcb, 0x56, 0x47, 0x4a, 0x7a, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x53, 0x37, 0x46, 0xc7, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x5c, 0x41, 0x44, 0xff,
-    0xf2, 0xf5, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf5, 0xf7, 0x2f, 0xff, 0x70, 0x57, 0x44, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0xac, 0x9c, 0x34, 0xff, 0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xb0, 0xa1, 0x34, 0xff,
-    0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x79, 0x42, 0x49, 0xff, 0xed, 0x63, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xe7, 0x63, 0x4a, 0xff, 0x70, 0x41, 0x47, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x45, 0xff, 0x56, 0x47, 0x4a, 0x7a, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x37, 0x46, 0xc7, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x5c, 0x41, 0x44, 0xff, 0xf2, 0xf5, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf5, 0xf7, 0x2f, 0xff, 0x70, 0x57, 0x44, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0xac, 0x9c, 0x34, 0xff, 0xfb, 0xf4, 0x23, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xaf, 0xa1, 0x34, 0xff, 0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff, 0x79, 0x42, 0x49, 0xff,
-    0xed, 0x63, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xe7, 0x63, 0x4a, 0xff,
-    0x70, 0x41, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x45, 0xff, 0x56, 0x48, 0x4a, 0x79,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x37, 0x46, 0xc7,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x5c, 0x41, 0x44, 0xff, 0xf2, 0xf5, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf5, 0xf7, 0x2f, 0xff,
-    0x70, 0x57, 0x44, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0xac, 0x9c, 0x34, 0xff,
-    0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xaf, 0xa1, 0x34, 0xff, 0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x38, 0x46, 0xff,
-    0x79, 0x42, 0x49, 0xff, 0xed, 0x63, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xe7, 0x63, 0x4a, 0xff, 0x70, 0x41, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x45, 0xff,
-    0x56, 0x48, 0x4a, 0x79, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x37, 0x46, 0xc7, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x5c, 0x41, 0x44, 0xff, 0xf2, 0xf5, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf5, 0xf7, 0x2f, 0xff, 0x70, 0x57, 0x44, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0xac, 0x9c, 0x34, 0xff, 0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xb0, 0xa1, 0x34, 0xff, 0x4d, 0x31, 0x47, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x38, 0x46, 0xff, 0x79, 0x42, 0x49, 0xff, 0xed, 0x63, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff,
-    0xfd, 0x68, 0x4b, 0xff, 0xe7, 0x63, 0x4a, 0xff, 0x70, 0x41, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x36, 0x45, 0xff, 0x56, 0x48, 0x4a, 0x79, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x52, 0x36, 0x46, 0xc7, 0x52, 0x37, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x51, 0x36, 0x46, 0xff, 0x5b, 0x40, 0x44, 0xff,
-    0xf2, 0xf5, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf5, 0xf7, 0x2e, 0xff, 0x6f, 0x56, 0x44, 0xff, 0x50, 0x35, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0xac, 0x9b, 0x34, 0xff, 0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xb0, 0xa1, 0x34, 0xff,
-    0x4c, 0x30, 0x47, 0xff, 0x52, 0x37, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x78, 0x42, 0x49, 0xff, 0xed, 0x63, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff, 0xfe, 0x68, 0x4b, 0xff,
-    0xfe, 0x68, 0x4b, 0xff, 0xfd, 0x68, 0x4b, 0xff, 0xe7, 0x63, 0x4a, 0xff, 0x70, 0x41, 0x47, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff, 0x53, 0x37, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xff, 0x53, 0x35, 0x45, 0xc9, 0x56, 0x48, 0x4a, 0x79, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7e, 0x65, 0x42, 0xbb, 0x7e, 0x66, 0x42, 0xff,
-    0x7e, 0x66, 0x42, 0xff, 0x7e, 0x66, 0x42, 0xff, 0x7e, 0x66, 0x42, 0xff, 0x7e, 0x65, 0x42, 0xff,
-    0x85, 0x6d, 0x43, 0xff, 0xf4, 0xf5, 0x57, 0xff, 0xf9, 0xfd, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff,
-    0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff,
-    0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff,
-    0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff,
-    0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff,
-    0xf9, 0xfc, 0x58, 0xff, 0xf9, 0xfc, 0x58, 0xff, 0xf6, 0xf6, 0x58, 0xff, 0x94, 0x7e, 0x46, 0xff,
-    0x7d, 0x65, 0x42, 0xff, 0x7e, 0x66, 0x42, 0xff, 0x7e, 0x66, 0x42, 0xff, 0x7e, 0x66, 0x42, 0xff,
-    0x7e, 0x66, 0x42, 0xff, 0x7e, 0x66, 0x42, 0xff, 0xac, 0x9b, 0x36, 0xff, 0xd5, 0xc9, 0x2c, 0xff,
-    0xd4, 0xc8, 0x2c, 0xff, 0xd4, 0xc8, 0x2c, 0xff, 0xd4, 0xc8, 0x2c, 0xff, 0xd4, 0xc8, 0x2c, 0xff,
-    0xd4, 0xc8, 0x2c, 0xff, 0xdd, 0xd2, 0x2b, 0xff, 0xf7, 0xef, 0x25, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xc3, 0xb4, 0x31, 0xff, 0x7b, 0x5f, 0x41, 0xff, 0x7f, 0x64, 0x40, 0xff, 0x7f, 0x64, 0x40, 0xff,
-    0x7f, 0x64, 0x40, 0xff, 0x7f, 0x64, 0x40, 0xff, 0x7f, 0x64, 0x40, 0xff, 0x93, 0x64, 0x43, 0xff,
-    0xcf, 0x5d, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff,
-    0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd6, 0x5c, 0x4a, 0xff, 0xd0, 0x5a, 0x49, 0xa1,
-    0x71, 0x3e, 0x47, 0x7f, 0x53, 0x35, 0x45, 0x86, 0x53, 0x35, 0x45, 0x86, 0x53, 0x35, 0x45, 0x86,
-    0x53, 0x35, 0x45, 0x86, 0x53, 0x35, 0x45, 0x86, 0x53, 0x32, 0x45, 0x87, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x38, 0x46, 0xc5, 0x53, 0x3b, 0x47, 0xc3, 0x53, 0x3b, 0x47, 0xc3, 0x53, 0x3b, 0x47, 0xc3,
-    0x53, 0x3b, 0x47, 0xc3, 0x51, 0x38, 0x47, 0xc5, 0xff, 0xff, 0xff, 0x00, 0xeb, 0xe7, 0x31, 0xcd,
-    0xed, 0xec, 0x31, 0xff, 0xed, 0xec, 0x31, 0xff, 0xed, 0xec, 0x31, 0xff, 0xed, 0xec, 0x31, 0xff,
-    0xed, 0xec, 0x2f, 0xff, 0xee, 0xec, 0x39, 0xff, 0xfa, 0xfb, 0xd4, 0xff, 0xfa, 0xfb, 0xdb, 0xff,
-    0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff,
-    0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff,
-    0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff,
-    0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff,
-    0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xda, 0xff, 0xfa, 0xfb, 0xdb, 0xff, 0xfa, 0xfb, 0xd5, 0xff,
-    0xef, 0xee, 0x49, 0xff, 0xed, 0xec, 0x2f, 0xff, 0xed, 0xec, 0x31, 0xff, 0xed, 0xec, 0x31, 0xff,
-    0xed, 0xec, 0x31, 0xff, 0xed, 0xec, 0x31, 0xff, 0xed, 0xeb, 0x31, 0xff, 0xa1, 0x93, 0x3b, 0xff,
-    0x5e, 0x43, 0x43, 0xff, 0x61, 0x47, 0x43, 0xff, 0x61, 0x47, 0x43, 0xff, 0x61, 0x47, 0x43, 0xff,
-    0x61, 0x47, 0x43, 0xff, 0x60, 0x46, 0x43, 0xff, 0x86, 0x6c, 0x3d, 0xff, 0xf2, 0xe8, 0x27, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf4, 0xeb, 0x26, 0xff, 0xee, 0xe3, 0x27, 0xff, 0xee, 0xe4, 0x27, 0xff,
-    0xee, 0xe4, 0x27, 0xff, 0xee, 0xe4, 0x27, 0xff, 0xee, 0xe4, 0x27, 0xff, 0xee, 0xe4, 0x27, 0xff,
-    0xd4, 0xc5, 0x2e, 0xff, 0x71, 0x4d, 0x44, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff, 0x60, 0x3c, 0x47, 0xff,
-    0x60, 0x32, 0x45, 0x87, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x53, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x46, 0xc9, 0xff, 0xff, 0xff, 0x00,
-    0xf6, 0xf8, 0x2f, 0xcf, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf9, 0xfe, 0x37, 0xff, 0xfa, 0xfc, 0xe1, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xea, 0xff,
-    0xfa, 0xfb, 0xe3, 0xff, 0xf9, 0xfd, 0x49, 0xff, 0xf8, 0xff, 0x2c, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xfe, 0x2e, 0xff,
-    0x9f, 0x93, 0x3b, 0xff, 0x50, 0x34, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x7c, 0x61, 0x3f, 0xff,
-    0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xdb, 0xd0, 0x2b, 0xff, 0x65, 0x4b, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x2c, 0x44, 0x8b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x46, 0xc9,
-    0xff, 0xff, 0xff, 0x00, 0xf6, 0xf8, 0x2f, 0xcf, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf9, 0xfe, 0x37, 0xff,
-    0xfa, 0xfc, 0xe2, 0xff, 0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfb, 0xe3, 0xff, 0xf9, 0xfd, 0x49, 0xff, 0xf8, 0xff, 0x2c, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf9, 0xfd, 0x2e, 0xff, 0x9f, 0x93, 0x3b, 0xff, 0x50, 0x34, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xdb, 0xd0, 0x2b, 0xff, 0x65, 0x4b, 0x43, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x2c, 0x44, 0x8b, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x35, 0x45, 0xc9,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x35, 0x46, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xf8, 0x2f, 0xcf, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf9, 0xfe, 0x37, 0xff, 0xfa, 0xfc, 0xe2, 0xff, 0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfb, 0xe3, 0xff, 0xf9, 0xfd, 0x49, 0xff,
-    0xf8, 0xff, 0x2c, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf9, 0xfd, 0x2e, 0xff, 0x9f, 0x93, 0x3b, 0xff, 0x50, 0x34, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xdb, 0xd0, 0x2b, 0xff,
-    0x65, 0x4b, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x2c, 0x44, 0x8b,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x46, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xf8, 0x2f, 0xcf,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf9, 0xfe, 0x37, 0xff, 0xfa, 0xfc, 0xe2, 0xff, 0xfa, 0xfc, 0xea, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfb, 0xe3, 0xff,
-    0xf9, 0xfd, 0x49, 0xff, 0xf8, 0xff, 0x2c, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf9, 0xfd, 0x2e, 0xff, 0x9f, 0x93, 0x3b, 0xff,
-    0x50, 0x34, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xdb, 0xd0, 0x2b, 0xff, 0x65, 0x4b, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x2c, 0x44, 0x8b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x53, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x46, 0xc9, 0xff, 0xff, 0xff, 0x00,
-    0xf6, 0xf8, 0x2f, 0xcf, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf9, 0xfe, 0x37, 0xff, 0xfa, 0xfc, 0xe2, 0xff,
-    0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xea, 0xff,
-    0xfa, 0xfb, 0xe3, 0xff, 0xf9, 0xfd, 0x49, 0xff, 0xf8, 0xff, 0x2c, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf9, 0xfd, 0x2e, 0xff,
-    0x9f, 0x93, 0x3b, 0xff, 0x50, 0x34, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x7b, 0x61, 0x40, 0xff,
-    0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xdb, 0xd0, 0x2b, 0xff, 0x65, 0x4b, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x2c, 0x44, 0x8b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x46, 0xc9,
-    0xff, 0xff, 0xff, 0x00, 0xf6, 0xf8, 0x1b, 0xe3, 0xf8, 0xff, 0x19, 0xff, 0xf8, 0xff, 0x19, 0xff,
-    0xf8, 0xff, 0x19, 0xff, 0xf8, 0xff, 0x19, 0xff, 0xf8, 0xff, 0x16, 0xff, 0xf9, 0xff, 0x24, 0xff,
-    0xfa, 0xfc, 0xe1, 0xff, 0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfb, 0xe3, 0xff, 0xf9, 0xfd, 0x3a, 0xff, 0xf8, 0xff, 0x15, 0xff,
-    0xf8, 0xff, 0x19, 0xff, 0xf8, 0xff, 0x19, 0xff, 0xf8, 0xff, 0x19, 0xff, 0xf8, 0xff, 0x19, 0xff,
-    0xf8, 0xfe, 0x19, 0xff, 0x9f, 0x93, 0x32, 0xff, 0x50, 0x34, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf5, 0x23, 0xff,
-    0xfd, 0xfa, 0x21, 0xff, 0xfd, 0xfa, 0x21, 0xff, 0xfd, 0xfa, 0x21, 0xff, 0xfd, 0xfa, 0x21, 0xff,
-    0xfd, 0xfa, 0x21, 0xff, 0xfd, 0xfa, 0x21, 0xff, 0xdc, 0xd4, 0x25, 0xff, 0x5a, 0x39, 0x35, 0xff,
-    0x45, 0x25, 0x37, 0xff, 0x45, 0x25, 0x37, 0xff, 0x45, 0x25, 0x37, 0xff, 0x45, 0x25, 0x37, 0xff,
-    0x45, 0x25, 0x37, 0xff, 0x45, 0x25, 0x37, 0xff, 0x45, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff,
-    0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff,
-    0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff,
-    0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff,
-    0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff,
-    0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff, 0x44, 0x23, 0x36, 0xff,
-    0x4e, 0x31, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xc5, 0x53, 0x37, 0x46, 0xc7,
-    0x52, 0x2e, 0x44, 0xcf, 0x52, 0x2e, 0x44, 0xcf, 0x52, 0x2d, 0x44, 0xd1, 0x52, 0x2d, 0x44, 0xd1,
-    0x52, 0x2d, 0x43, 0xd1, 0x51, 0x2d, 0x43, 0xd1, 0x50, 0x1d, 0x41, 0x96, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xcf, 0x2e, 0xfa, 0xfb, 0xd1, 0xff,
-    0xfa, 0xfb, 0xd1, 0xff, 0xfa, 0xfb, 0xd1, 0xff, 0xfa, 0xfb, 0xd1, 0xff, 0xfa, 0xfb, 0xd1, 0xff,
-    0xfa, 0xfb, 0xd2, 0xff, 0xfa, 0xfc, 0xe8, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfb, 0xd5, 0xff,
-    0xfa, 0xfb, 0xd1, 0xff, 0xfa, 0xfb, 0xd1, 0xff, 0xfa, 0xfb, 0xd1, 0xff, 0xfa, 0xfb, 0xd1, 0xff,
-    0xfa, 0xfb, 0xd1, 0xff, 0xfa, 0xfb, 0xd2, 0xff, 0xa0, 0x92, 0x87, 0xff, 0x50, 0x34, 0x44, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xbf, 0xb0, 0x33, 0xff, 0x73, 0x56, 0x44, 0xff, 0x77, 0x5c, 0x43, 0xff, 0x77, 0x5c, 0x43, 0xff,
-    0x77, 0x5c, 0x43, 0xff, 0x77, 0x5c, 0x43, 0xff, 0x76, 0x5b, 0x42, 0xff, 0x8f, 0x76, 0x63, 0xff,
-    0xdb, 0xd0, 0xd1, 0xff, 0xe6, 0xdc, 0xdf, 0xff, 0xe6, 0xdc, 0xdf, 0xff, 0xe6, 0xdc, 0xdf, 0xff,
-    0xe6, 0xdc, 0xdf, 0xff, 0xe6, 0xdc, 0xdf, 0xff, 0xe5, 0xdc, 0xdf, 0xff, 0xeb, 0xe7, 0xe6, 0xff,
-    0xed, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff,
-    0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff,
-    0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff,
-    0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff,
-    0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff, 0xec, 0xea, 0xe8, 0xff,
-    0xee, 0xeb, 0xea, 0xff, 0x8f, 0x7d, 0x84, 0xff, 0x50, 0x34, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x37, 0x46, 0xc7,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe8, 0x16,
-    0xfa, 0xfc, 0xeb, 0xff, 0xfa, 0xfc, 0xeb, 0xff, 0xfa, 0xfc, 0xeb, 0xff, 0xfa, 0xfc, 0xeb, 0xff,
-    0xfa, 0xfc, 0xeb, 0xff, 0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xea, 0xff, 0xfa, 0xfc, 0xeb, 0xff, 0xfa, 0xfc, 0xeb, 0xff, 0xfa, 0xfc, 0xeb, 0xff,
-    0xfa, 0xfc, 0xeb, 0xff, 0xfa, 0xfc, 0xeb, 0xff, 0xfa, 0xfc, 0xeb, 0xff, 0xa0, 0x92, 0x93, 0xff,
-    0x50, 0x34, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xaf, 0xa0, 0x34, 0xff, 0x4a, 0x2e, 0x47, 0xff, 0x51, 0x35, 0x46, 0xff,
-    0x51, 0x35, 0x46, 0xff, 0x51, 0x35, 0x46, 0xff, 0x51, 0x35, 0x46, 0xff, 0x50, 0x35, 0x46, 0xff,
-    0x75, 0x5b, 0x6b, 0xff, 0xe9, 0xe1, 0xe4, 0xff, 0xf6, 0xf2, 0xf2, 0xff, 0xf6, 0xf2, 0xf2, 0xff,
-    0xf6, 0xf2, 0xf2, 0xff, 0xf6, 0xf2, 0xf2, 0xff, 0xf6, 0xf2, 0xf2, 0xff, 0xf6, 0xf2, 0xf2, 0xff,
-    0xfc, 0xfc, 0xf9, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff,
-    0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff,
-    0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff,
-    0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff,
-    0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff,
-    0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00,
-    0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xa0, 0x92, 0x92, 0xff, 0x50, 0x34, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x7b, 0x61, 0x40, 0xff,
-    0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xaf, 0xa1, 0x34, 0xff, 0x4d, 0x31, 0x47, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x45, 0xff, 0x77, 0x5d, 0x6a, 0xff, 0xe8, 0xe1, 0xe2, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xfc, 0xfc, 0xf8, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff,
-    0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x37, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9,
-    0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xa0, 0x92, 0x92, 0xff, 0x50, 0x34, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xaf, 0xa1, 0x34, 0xff,
-    0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x45, 0xff, 0x77, 0x5d, 0x6a, 0xff, 0xe8, 0xe1, 0xe2, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xfc, 0xfc, 0xf8, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff,
-    0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x37, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xa0, 0x92, 0x92, 0xff, 0x50, 0x34, 0x43, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xaf, 0xa1, 0x34, 0xff, 0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x45, 0xff, 0x77, 0x5d, 0x6a, 0xff,
-    0xe8, 0xe1, 0xe2, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xfc, 0xfc, 0xf8, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x37, 0x46, 0xc7,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xa0, 0x92, 0x92, 0xff,
-    0x50, 0x34, 0x43, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x7b, 0x61, 0x40, 0xff, 0xf1, 0xe7, 0x27, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xaf, 0xa1, 0x34, 0xff, 0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x45, 0xff,
-    0x77, 0x5d, 0x6a, 0xff, 0xe8, 0xe1, 0xe2, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xfc, 0xfc, 0xf8, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x37, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00,
-    0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfb, 0xfc, 0xea, 0xff, 0xfb, 0xfd, 0xea, 0xff, 0xfb, 0xfd, 0xea, 0xff,
-    0xfb, 0xfd, 0xea, 0xff, 0xfb, 0xfd, 0xea, 0xff, 0xfb, 0xfd, 0xea, 0xff, 0xfb, 0xfb, 0xeb, 0xff,
-    0xa0, 0x91, 0x92, 0xff, 0x4e, 0x31, 0x43, 0xff, 0x50, 0x35, 0x46, 0xff, 0x50, 0x35, 0x46, 0xff,
-    0x50, 0x35, 0x46, 0xff, 0x50, 0x35, 0x46, 0xff, 0x50, 0x34, 0x46, 0xff, 0x7a, 0x5e, 0x40, 0xff,
-    0xf1, 0xe7, 0x27, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfa, 0xf2, 0x24, 0xff,
-    0xfa, 0xf2, 0x24, 0xff, 0xfa, 0xf2, 0x24, 0xff, 0xfa, 0xf2, 0x24, 0xff, 0xfa, 0xf2, 0x24, 0xff,
-    0xfa, 0xf2, 0x24, 0xff, 0xfa, 0xf2, 0x24, 0xff, 0xaf, 0xa1, 0x32, 0xff, 0x4b, 0x2e, 0x44, 0xff,
-    0x51, 0x35, 0x43, 0xff, 0x51, 0x35, 0x43, 0xff, 0x51, 0x35, 0x43, 0xff, 0x51, 0x35, 0x43, 0xff,
-    0x51, 0x35, 0x43, 0xff, 0x75, 0x5b, 0x68, 0xff, 0xe8, 0xe0, 0xe2, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xfb, 0xfc, 0xf8, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xfe, 0xfa, 0xff, 0xfd, 0xfe, 0xfb, 0xff, 0xfd, 0xfe, 0xfb, 0xff,
-    0xfd, 0xfe, 0xfb, 0xff, 0xfd, 0xfe, 0xfb, 0xff, 0xfd, 0xfe, 0xfb, 0xff, 0xfd, 0xfe, 0xfb, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff,
-    0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9,
-    0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xf9, 0xfa, 0xe7, 0xff, 0xc1, 0xb5, 0xaf, 0xff, 0xb5, 0xa8, 0xa4, 0xff,
-    0xb6, 0xa9, 0xa4, 0xff, 0xb6, 0xa9, 0xa4, 0xff, 0xb6, 0xa9, 0xa4, 0xff, 0xb6, 0xa9, 0xa4, 0xff,
-    0xb6, 0xa8, 0xa5, 0xff, 0xa9, 0x99, 0x6a, 0xff, 0xa0, 0x8d, 0x35, 0xff, 0xa0, 0x8e, 0x37, 0xff,
-    0xa0, 0x8e, 0x37, 0xff, 0xa0, 0x8e, 0x37, 0xff, 0xa0, 0x8e, 0x37, 0xff, 0xa0, 0x8e, 0x37, 0xff,
-    0xb7, 0xa4, 0x33, 0xff, 0xf5, 0xec, 0x26, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfa, 0xf2, 0x24, 0xff,
-    0xc3, 0xb0, 0x34, 0xff, 0xb5, 0xa1, 0x36, 0xff, 0xb6, 0xa1, 0x36, 0xff, 0xb6, 0xa1, 0x36, 0xff,
-    0xb6, 0xa1, 0x36, 0xff, 0xb6, 0xa1, 0x36, 0xff, 0xb5, 0xa1, 0x34, 0xff, 0xab, 0x9a, 0x62, 0xff,
-    0x9e, 0x8c, 0x98, 0xff, 0x9f, 0x8e, 0x95, 0xff, 0x9f, 0x8e, 0x96, 0xff, 0x9f, 0x8e, 0x96, 0xff,
-    0x9f, 0x8e, 0x96, 0xff, 0x9f, 0x8e, 0x95, 0xff, 0xb2, 0xa3, 0xaa, 0xff, 0xf1, 0xee, 0xed, 0xff,
-    0xf8, 0xf8, 0xf5, 0xff, 0xf8, 0xf8, 0xf5, 0xff, 0xf8, 0xf8, 0xf5, 0xff, 0xf8, 0xf8, 0xf5, 0xff,
-    0xf8, 0xf8, 0xf5, 0xff, 0xf8, 0xf8, 0xf5, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfb, 0xff, 0xe2, 0xdc, 0xdd, 0xff, 0xb6, 0xa8, 0xae, 0xff, 0xb8, 0xaa, 0xaf, 0xff,
-    0xb8, 0xaa, 0xaf, 0xff, 0xb8, 0xaa, 0xaf, 0xff, 0xb8, 0xaa, 0xaf, 0xff, 0xb8, 0xaa, 0xaf, 0xff,
-    0xc3, 0xb6, 0xbb, 0xff, 0xf3, 0xf1, 0xf0, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff,
-    0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfd, 0xe9, 0xff, 0xf7, 0xf7, 0xe5, 0xff, 0x48, 0x2a, 0x3c, 0x55,
-    0x4d, 0x2f, 0x3f, 0xff, 0x4f, 0x32, 0x41, 0xff, 0x4f, 0x32, 0x41, 0xff, 0x4f, 0x32, 0x41, 0xff,
-    0x4f, 0x32, 0x41, 0xff, 0x4e, 0x31, 0x42, 0xff, 0xac, 0x9b, 0x31, 0xff, 0xfd, 0xf7, 0x23, 0xff,
-    0xfc, 0xf4, 0x23, 0xff, 0xfc, 0xf4, 0x23, 0xff, 0xfc, 0xf4, 0x23, 0xff, 0xfc, 0xf4, 0x23, 0xff,
-    0xfc, 0xf4, 0x23, 0xff, 0xfb, 0xf3, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xfc, 0xf3, 0x24, 0xff, 0x73, 0x58, 0x42, 0xff, 0x4d, 0x31, 0x47, 0xff, 0x4f, 0x33, 0x47, 0xff,
-    0x4f, 0x33, 0x47, 0xff, 0x4f, 0x33, 0x47, 0xff, 0x4f, 0x33, 0x47, 0xff, 0x4e, 0x30, 0x45, 0xff,
-    0x9e, 0x8e, 0x97, 0xff, 0xfc, 0xf9, 0xf8, 0xff, 0xf8, 0xf4, 0xf4, 0xff, 0xf8, 0xf4, 0xf4, 0xff,
-    0xf8, 0xf4, 0xf4, 0xff, 0xf8, 0xf4, 0xf4, 0xff, 0xf8, 0xf4, 0xf4, 0xff, 0xf9, 0xf6, 0xf5, 0xff,
-    0xfc, 0xfe, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbc, 0xad, 0xb4, 0xff, 0x4a, 0x2c, 0x3d, 0xff,
-    0x4e, 0x32, 0x41, 0xff, 0x4e, 0x32, 0x41, 0xff, 0x4e, 0x32, 0x41, 0xff, 0x4e, 0x32, 0x41, 0xff,
-    0x4e, 0x32, 0x41, 0xff, 0x6b, 0x4e, 0x5d, 0xff, 0xe5, 0xdf, 0xe1, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfd, 0xe9, 0xff, 0xf7, 0xf7, 0xe5, 0xff,
-    0x4b, 0x30, 0x3f, 0x55, 0x51, 0x35, 0x44, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0xac, 0x9c, 0x34, 0xff,
-    0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff, 0xf9, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff,
-    0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x6e, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00,
-    0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfd, 0xe9, 0xff,
-    0xf7, 0xf7, 0xe5, 0xff, 0x4b, 0x30, 0x3f, 0x55, 0x51, 0x35, 0x44, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0xac, 0x9c, 0x34, 0xff, 0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff, 0xfa, 0xf6, 0xf6, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x6e, 0x54, 0x61, 0xff,
-    0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff,
-    0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9,
-    0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfd, 0xe9, 0xff, 0xf7, 0xf7, 0xe5, 0xff, 0x4b, 0x30, 0x3f, 0x55, 0x51, 0x35, 0x44, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0xac, 0x9c, 0x34, 0xff, 0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff,
-    0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff,
-    0xfa, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x6e, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff,
-    0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x33, 0x45, 0xcb,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfd, 0xe9, 0xff, 0xf7, 0xf7, 0xe5, 0xff, 0x4b, 0x30, 0x3f, 0x55,
-    0x51, 0x35, 0x44, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0xac, 0x9c, 0x34, 0xff, 0xfb, 0xf4, 0x23, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff,
-    0x9e, 0x8f, 0x96, 0xff, 0xfa, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff,
-    0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x6e, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf8, 0xe6, 0x18,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff,
-    0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfc, 0xe9, 0xff, 0xfa, 0xfd, 0xe9, 0xff, 0xf7, 0xf7, 0xe5, 0xff,
-    0x4b, 0x30, 0x3f, 0x55, 0x51, 0x35, 0x44, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0xac, 0x9c, 0x34, 0xff,
-    0xfb, 0xf4, 0x23, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff, 0xfa, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff,
-    0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x6e, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x50, 0x23, 0x42, 0x92, 0x50, 0x29, 0x44, 0x8e, 0x50, 0x29, 0x44, 0x8e,
-    0x50, 0x29, 0x44, 0x8e, 0x50, 0x29, 0x44, 0x8e, 0x4e, 0x26, 0x41, 0x8f, 0xff, 0xff, 0xff, 0x00,
-    0xfc, 0xfb, 0xef, 0x09, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa,
-    0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa,
-    0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa,
-    0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa,
-    0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa,
-    0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa,
-    0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa, 0xff, 0xff, 0xf2, 0xaa,
-    0xfc, 0xfb, 0xef, 0xaa, 0x6c, 0x4e, 0x3f, 0x55, 0x6f, 0x53, 0x41, 0xff, 0x71, 0x55, 0x42, 0xff,
-    0x71, 0x55, 0x42, 0xff, 0x71, 0x55, 0x42, 0xff, 0x71, 0x55, 0x42, 0xff, 0x70, 0x54, 0x42, 0xff,
-    0xba, 0xaa, 0x32, 0xff, 0xfb, 0xf3, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff, 0xfa, 0xf6, 0xf6, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x6e, 0x54, 0x61, 0xff,
-    0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff,
-    0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x48, 0x27, 0x3b, 0x8f, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa,
-    0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa,
-    0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa,
-    0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa,
-    0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa,
-    0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa,
-    0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa, 0x48, 0x29, 0x3b, 0xaa,
-    0x47, 0x29, 0x3b, 0xaa, 0x4e, 0x32, 0x3b, 0xaa, 0xe8, 0xdf, 0x27, 0xc6, 0xec, 0xe2, 0x27, 0xff,
-    0xec, 0xe2, 0x28, 0xff, 0xec, 0xe2, 0x28, 0xff, 0xec, 0xe2, 0x28, 0xff, 0xec, 0xe2, 0x28, 0xff,
-    0xec, 0xe2, 0x28, 0xff, 0xf3, 0xea, 0x26, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff,
-    0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff,
-    0xfa, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x6e, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff,
-    0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x36, 0x46, 0xc7, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x59, 0x3e, 0x45, 0xff, 0xea, 0xe0, 0x29, 0xff,
-    0xfa, 0xf2, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff,
-    0x9e, 0x8f, 0x96, 0xff, 0xfa, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff,
-    0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x6e, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x36, 0x46, 0xc7,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x58, 0x3e, 0x45, 0xff,
-    0xeb, 0xe0, 0x28, 0xff, 0xfa, 0xf2, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff, 0xfa, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff,
-    0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x6e, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x53, 0x36, 0x46, 0xc7, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0x58, 0x3e, 0x45, 0xff, 0xeb, 0xe0, 0x28, 0xff, 0xfa, 0xf2, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff, 0xfa, 0xf6, 0xf6, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x6e, 0x54, 0x61, 0xff,
-    0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff,
-    0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x53, 0x36, 0x46, 0xc7, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0x58, 0x3e, 0x45, 0xff, 0xeb, 0xe0, 0x28, 0xff, 0xfa, 0xf2, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff,
-    0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff,
-    0xfa, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x6e, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff,
-    0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x45, 0xc7, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x36, 0x46, 0xc7, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0x58, 0x3e, 0x45, 0xff, 0xeb, 0xe0, 0x28, 0xff,
-    0xfa, 0xf2, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x35, 0x44, 0xff,
-    0x9e, 0x8f, 0x96, 0xff, 0xf9, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf3, 0xff,
-    0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb5, 0xff, 0x4f, 0x32, 0x41, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x6d, 0x54, 0x61, 0xff, 0xe5, 0xdf, 0xe2, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfd, 0xff, 0x96, 0x85, 0x8c, 0xff, 0x50, 0x33, 0x42, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x36, 0x45, 0xc7,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x31, 0x44, 0xcd,
-    0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb,
-    0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb,
-    0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb,
-    0x52, 0x34, 0x45, 0xc9, 0x53, 0x36, 0x46, 0xc7, 0x53, 0x38, 0x46, 0xc5, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x37, 0x47, 0xff, 0x52, 0x36, 0x48, 0xff, 0x51, 0x36, 0x49, 0xff, 0x51, 0x36, 0x49, 0xff,
-    0x51, 0x36, 0x49, 0xff, 0x51, 0x36, 0x49, 0xff, 0x51, 0x35, 0x49, 0xff, 0x58, 0x3c, 0x48, 0xff,
-    0xeb, 0xdf, 0x2b, 0xff, 0xfa, 0xf2, 0x26, 0xff, 0xf9, 0xf1, 0x27, 0xff, 0xf9, 0xf1, 0x27, 0xff,
-    0xf9, 0xf1, 0x27, 0xff, 0xf9, 0xf1, 0x27, 0xff, 0xf9, 0xf1, 0x27, 0xff, 0xf9, 0xf1, 0x25, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x35, 0x44, 0xff, 0x9e, 0x8f, 0x96, 0xff, 0xf9, 0xf6, 0xf6, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf5, 0xf1, 0xf1, 0xff,
-    0xf7, 0xf4, 0xf3, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb5, 0xff,
-    0x4e, 0x31, 0x40, 0xff, 0x52, 0x36, 0x44, 0xff, 0x52, 0x36, 0x44, 0xff, 0x52, 0x36, 0x44, 0xff,
-    0x52, 0x36, 0x44, 0xff, 0x52, 0x36, 0x44, 0xff, 0x6e, 0x54, 0x61, 0xff, 0xe5, 0xe0, 0xe2, 0xff,
-    0xfd, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfb, 0xff,
-    0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x00, 0x96, 0x83, 0x8b, 0x7a, 0x4f, 0x2f, 0x41, 0xcf,
-    0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb, 0x52, 0x33, 0x45, 0xcb,
-    0x52, 0x31, 0x44, 0xcd, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x53, 0x36, 0x45, 0xc7,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x45, 0xff, 0x80, 0x6b, 0x50, 0xff, 0xcf, 0xc6, 0x49, 0xff, 0xd3, 0xcc, 0x46, 0xff,
-    0xd3, 0xcc, 0x46, 0xff, 0xd3, 0xcc, 0x46, 0xff, 0xd3, 0xcc, 0x46, 0xff, 0xd3, 0xcc, 0x47, 0xff,
-    0xd5, 0xce, 0x46, 0xff, 0xf5, 0xf6, 0x3d, 0xff, 0xf8, 0xfb, 0x3b, 0xff, 0xf8, 0xfa, 0x3b, 0xff,
-    0xf8, 0xfa, 0x3b, 0xff, 0xf8, 0xfa, 0x3b, 0xff, 0xf8, 0xfa, 0x3b, 0xff, 0xf8, 0xfa, 0x3b, 0xff,
-    0xf9, 0xf5, 0x2f, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xff, 0xa1, 0x92, 0x98, 0xff, 0xfd, 0xfe, 0xfb, 0xff,
-    0xfa, 0xfb, 0xf8, 0xff, 0xfa, 0xfb, 0xf8, 0xff, 0xfa, 0xfb, 0xf8, 0xff, 0xfa, 0xfb, 0xf8, 0xff,
-    0xfa, 0xfb, 0xf8, 0xff, 0xfb, 0xfc, 0xf8, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfb, 0xff,
-    0xee, 0xeb, 0xea, 0xff, 0xd5, 0xce, 0xcf, 0xff, 0xd6, 0xcf, 0xd0, 0xff, 0xd6, 0xcf, 0xd0, 0xff,
-    0xd6, 0xcf, 0xd0, 0xff, 0xd6, 0xcf, 0xd0, 0xff, 0xd6, 0xcf, 0xd0, 0xff, 0xca, 0xc2, 0xc4, 0xff,
-    0x95, 0x83, 0x8b, 0xff, 0x8a, 0x78, 0x80, 0xff, 0x8a, 0x78, 0x80, 0xff, 0x8a, 0x78, 0x80, 0xff,
-    0x8a, 0x78, 0x80, 0xff, 0x8a, 0x78, 0x80, 0xff, 0x8a, 0x76, 0x80, 0x87, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x52, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x36, 0x45, 0xff, 0x8e, 0x7c, 0x4d, 0xff, 0xf5, 0xf5, 0x32, 0xff,
-    0xfa, 0xff, 0x2d, 0xff, 0xfa, 0xff, 0x2d, 0xff, 0xfa, 0xff, 0x2d, 0xff, 0xfa, 0xff, 0x2d, 0xff,
-    0xfa, 0xff, 0x2d, 0xff, 0xfa, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf9, 0xf8, 0x29, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff,
-    0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xff, 0xa1, 0x93, 0x99, 0xff,
-    0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xe4, 0xe1, 0xe1, 0xff, 0x67, 0x4d, 0x5a, 0xff, 0x4f, 0x33, 0x42, 0xff, 0x4f, 0x33, 0x42, 0xff,
-    0x4f, 0x33, 0x42, 0xff, 0x4f, 0x33, 0x42, 0xff, 0x4f, 0x33, 0x42, 0xff, 0x4e, 0x2c, 0x40, 0xd1,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x59, 0x48, 0x4d, 0x79, 0x52, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x36, 0x45, 0xff, 0x8d, 0x7b, 0x4d, 0xff,
-    0xf3, 0xf4, 0x33, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf9, 0xf8, 0x29, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xff,
-    0xa1, 0x93, 0x99, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xe4, 0xe1, 0xe1, 0xff, 0x6a, 0x52, 0x5e, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x32, 0x45, 0xcb, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x59, 0x4a, 0x4d, 0x77, 0x52, 0x35, 0x45, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x36, 0x45, 0xff,
-    0x8d, 0x7b, 0x4d, 0xff, 0xf3, 0xf4, 0x33, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf9, 0xf8, 0x29, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x35, 0x44, 0xff, 0xa1, 0x93, 0x99, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xe4, 0xe1, 0xe1, 0xff, 0x6a, 0x52, 0x5e, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x32, 0x45, 0xcb, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x59, 0x4a, 0x4d, 0x77, 0x52, 0x35, 0x45, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x36, 0x45, 0xff, 0x8d, 0x7b, 0x4d, 0xff, 0xf3, 0xf4, 0x33, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf9, 0xf8, 0x29, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff, 0x76, 0x5c, 0x42, 0xff,
-    0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xff, 0xa1, 0x93, 0x99, 0xff, 0xfe, 0xff, 0xfd, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xe4, 0xe1, 0xe1, 0xff,
-    0x6a, 0x52, 0x5e, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x32, 0x44, 0xcb, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x59, 0x4a, 0x4d, 0x77,
-    0x52, 0x35, 0x45, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x36, 0x45, 0xff, 0x8d, 0x7b, 0x4d, 0xff, 0xf3, 0xf4, 0x33, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf9, 0xf8, 0x29, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff,
-    0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xf9, 0xf1, 0x24, 0xff, 0xfc, 0xf3, 0x24, 0xff,
-    0x76, 0x5c, 0x42, 0xff, 0x51, 0x36, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x51, 0x35, 0x44, 0xff, 0xa1, 0x93, 0x99, 0xff,
-    0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xe4, 0xe1, 0xe1, 0xff, 0x6a, 0x52, 0x5e, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x32, 0x44, 0xcb,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x59, 0x47, 0x4d, 0x7a, 0x52, 0x33, 0x44, 0xcb, 0x52, 0x36, 0x45, 0xc7, 0x52, 0x36, 0x45, 0xc7,
-    0x52, 0x36, 0x45, 0xc7, 0x52, 0x36, 0x45, 0xc7, 0x51, 0x34, 0x45, 0xc9, 0x8e, 0x7b, 0x4d, 0xb1,
-    0xf5, 0xf5, 0x32, 0xcb, 0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1,
-    0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1,
-    0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1,
-    0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xff, 0x2d, 0xd1, 0xfa, 0xf8, 0x28, 0xd5, 0xf9, 0xf1, 0x22, 0xff,
-    0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff,
-    0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff,
-    0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff, 0xf9, 0xf1, 0x22, 0xff,
-    0xfc, 0xf3, 0x22, 0xff, 0x73, 0x58, 0x40, 0xff, 0x4d, 0x2f, 0x45, 0xff, 0x4f, 0x32, 0x45, 0xff,
-    0x4f, 0x32, 0x45, 0xff, 0x4f, 0x32, 0x45, 0xff, 0x4f, 0x32, 0x45, 0xff, 0x4d, 0x2f, 0x42, 0xff,
-    0xa0, 0x91, 0x99, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfb, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xe4, 0xe1, 0xe2, 0x1c, 0x6a, 0x50, 0x5e, 0xad, 0x53, 0x36, 0x45, 0xc7,
-    0x52, 0x36, 0x45, 0xc7, 0x52, 0x36, 0x45, 0xc7, 0x52, 0x36, 0x45, 0xc7, 0x52, 0x36, 0x45, 0xc7,
-    0x51, 0x2f, 0x43, 0xcf, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf2, 0xed, 0x46, 0x8e,
-    0xfa, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff,
-    0xf9, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff,
-    0xf9, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff, 0xf9, 0xf6, 0x49, 0xff,
-    0xf9, 0xf6, 0x49, 0xff, 0xfb, 0xf7, 0x49, 0xff, 0xac, 0x9d, 0x5c, 0xff, 0x97, 0x86, 0x5f, 0xff,
-    0x99, 0x88, 0x5f, 0xff, 0x99, 0x88, 0x5f, 0xff, 0x99, 0x88, 0x5f, 0xff, 0x99, 0x88, 0x5f, 0xff,
-    0x97, 0x87, 0x5e, 0xff, 0xae, 0xa1, 0x8e, 0xff, 0xcb, 0xc2, 0xc5, 0xff, 0xcc, 0xc2, 0xc4, 0xff,
-    0xcc, 0xc2, 0xc4, 0xff, 0xcc, 0xc2, 0xc4, 0xff, 0xcc, 0xc2, 0xc4, 0xff, 0xcb, 0xc2, 0xc4, 0xff,
-    0xd6, 0xce, 0xcf, 0xff, 0xf8, 0xf7, 0xf5, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xe9, 0xe5, 0xe5, 0xff,
-    0xcb, 0xc1, 0xc3, 0xff, 0xcc, 0xc2, 0xc4, 0xff, 0xcc, 0xc2, 0xc4, 0xff, 0xcc, 0xc2, 0xc4, 0xff,
-    0xcc, 0xc2, 0xc4, 0xff, 0xcc, 0xc2, 0xc4, 0xff, 0xc9, 0xbf, 0xc1, 0x30, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x4e, 0x32, 0x47, 0xcb, 0x4c, 0x2f, 0x46, 0xcf,
-    0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2f, 0x46, 0xcf,
-    0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2f, 0x46, 0xcf,
-    0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2f, 0x46, 0xcf, 0x4c, 0x2e, 0x46, 0xcf,
-    0xa9, 0x9d, 0x39, 0xc5, 0xfb, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff,
-    0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xf8, 0xff, 0x2d, 0xff, 0xfa, 0xff, 0x2d, 0xff,
-    0xfb, 0xff, 0x2d, 0xff, 0xfb, 0xff, 0x2d, 0xff, 0xfb, 0xff, 0x2d, 0xff, 0xfb, 0xff, 0x2d, 0xff,
-    0xfb, 0xff, 0x2d, 0xff, 0xfb, 0xff, 0x2c, 0xff, 0xf9, 0xff, 0x2d, 0x55, 0x46, 0x26, 0x3f, 0xff,
-    0x4c, 0x2f, 0x3f, 0xff, 0x4c, 0x2f, 0x3f, 0xff, 0x4c, 0x2f, 0x3f, 0xff, 0x4c, 0x2f, 0x3f, 0xff,
-    0x4c, 0x2e, 0x3e, 0xff, 0x74, 0x5a, 0x67, 0xff, 0xec, 0xe8, 0xea, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xbb, 0xac, 0xb3, 0xff, 0x48, 0x29, 0x3a, 0xff, 0x4c, 0x2f, 0x3f, 0xff, 0x4c, 0x2f, 0x3f, 0xff,
-    0x4c, 0x2f, 0x3f, 0xff, 0x4c, 0x2f, 0x3f, 0xff, 0x4c, 0x2f, 0x3f, 0xff, 0x4b, 0x26, 0x3c, 0x8f,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x54, 0x3a, 0x47, 0xc3,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0xab, 0xa0, 0x39, 0xff, 0xfb, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xfe, 0x2e, 0xff, 0xf6, 0xfc, 0x2d, 0x55,
-    0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x45, 0xff, 0x79, 0x60, 0x6c, 0xff, 0xed, 0xe8, 0xea, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x51, 0x2f, 0x44, 0x8a, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x54, 0x3a, 0x47, 0xc3, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0xab, 0xa0, 0x39, 0xff, 0xfb, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xfe, 0x2e, 0xff,
-    0xf6, 0xfc, 0x2d, 0x55, 0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x45, 0xff, 0x79, 0x60, 0x6c, 0xff,
-    0xed, 0xe8, 0xea, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x2f, 0x44, 0x8a, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x54, 0x3a, 0x47, 0xc3, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff, 0xab, 0xa0, 0x39, 0xff,
-    0xfb, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xfe, 0x2e, 0xff, 0xf6, 0xfc, 0x2d, 0x55, 0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x45, 0xff,
-    0x79, 0x60, 0x6c, 0xff, 0xed, 0xe8, 0xea, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff,
-    0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x2f, 0x44, 0x8a, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x54, 0x3a, 0x47, 0xc3, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x46, 0xff,
-    0xab, 0xa0, 0x39, 0xff, 0xfb, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xfe, 0x2e, 0xff, 0xf6, 0xfc, 0x2d, 0x55, 0x4d, 0x31, 0x47, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x45, 0xff, 0x79, 0x60, 0x6c, 0xff, 0xed, 0xe8, 0xea, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff,
-    0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x2f, 0x44, 0x8a,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x54, 0x3a, 0x47, 0xc3,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x37, 0x46, 0xff, 0xab, 0xa0, 0x39, 0xff, 0xfb, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff,
-    0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xff, 0x2e, 0xff, 0xf8, 0xfe, 0x2e, 0xff, 0xf6, 0xfc, 0x2d, 0x55,
-    0x4d, 0x31, 0x47, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x37, 0x45, 0xff, 0x79, 0x60, 0x6c, 0xff, 0xed, 0xe8, 0xea, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff,
-    0xfe, 0xff, 0xfc, 0xff, 0xbd, 0xae, 0xb6, 0xff, 0x4f, 0x33, 0x41, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xc5,
-    0x50, 0x2f, 0x44, 0x8a, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x50, 0x2d, 0x44, 0x8b, 0x50, 0x2a, 0x42, 0x8d, 0x50, 0x2a, 0x42, 0x8d, 0x50, 0x2a, 0x42, 0x8d,
-    0x50, 0x2a, 0x41, 0x8d, 0x50, 0x2a, 0x41, 0x8d, 0x50, 0x2a, 0x41, 0x8d, 0x50, 0x2a, 0x41, 0x8d,
-    0x50, 0x2c, 0x41, 0x8b, 0x50, 0x2c, 0x42, 0x8b, 0x50, 0x2c, 0x42, 0x8b, 0x50, 0x2c, 0x42, 0x8b,
-    0x50, 0x2c, 0x42, 0x8b, 0x4e, 0x2a, 0x42, 0x8d, 0xae, 0xa1, 0x38, 0x83, 0xff, 0xff, 0x2c, 0x8b,
-    0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa,
-    0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa,
-    0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa,
-    0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa,
-    0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa, 0xff, 0xff, 0x2c, 0xaa,
-    0xff, 0xff, 0x2d, 0x39, 0x4e, 0x32, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x73, 0x5b, 0x67, 0xff,
-    0xd3, 0xcb, 0xcf, 0xff, 0xe0, 0xdc, 0xde, 0xff, 0xe0, 0xdc, 0xde, 0xff, 0xe0, 0xdc, 0xde, 0xff,
-    0xe0, 0xdc, 0xde, 0xff, 0xe0, 0xdc, 0xde, 0xff, 0xe0, 0xdc, 0xde, 0xff, 0xe0, 0xdc, 0xde, 0xff,
-    0xe0, 0xdc, 0xde, 0xff, 0xe0, 0xdc, 0xde, 0xff, 0xe0, 0xdc, 0xde, 0xff, 0xe0, 0xdc, 0xde, 0xff,
-    0xe0, 0xdc, 0xde, 0xff, 0xe1, 0xdc, 0xdf, 0x22, 0xbb, 0xad, 0xb4, 0x3e, 0x4d, 0x26, 0x3e, 0x8f,
-    0x50, 0x2c, 0x42, 0x8b, 0x50, 0x2c, 0x42, 0x8b, 0x50, 0x2c, 0x42, 0x8b, 0x50, 0x2c, 0x42, 0x8b,
-    0x50, 0x2c, 0x42, 0x8b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x4d, 0x2c, 0x45, 0x8b, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa,
-    0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa,
-    0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa,
-    0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa,
-    0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa, 0x4d, 0x30, 0x47, 0xaa,
-    0x4d, 0x30, 0x47, 0xaa, 0x50, 0x35, 0x47, 0xaa, 0x52, 0x37, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x58, 0x3d, 0x4b, 0xff, 0x68, 0x50, 0x5c, 0xff, 0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x52, 0x5e, 0xff,
-    0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x52, 0x5e, 0xff,
-    0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x52, 0x5e, 0xff,
-    0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x52, 0x5e, 0xff, 0x6a, 0x4f, 0x5e, 0xaf, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x52, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x34, 0x45, 0xc9,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x52, 0x34, 0x45, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x35, 0x45, 0xc9,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x52, 0x34, 0x45, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0x52, 0x35, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x34, 0x45, 0xc9, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff,
-    0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x53, 0x38, 0x46, 0xff, 0x52, 0x34, 0x45, 0xc9,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x52, 0x34, 0x45, 0xc9, 0x54, 0x38, 0x47, 0xc5,
-    0x54, 0x38, 0x47, 0xc5, 0x54, 0x38, 0x47, 0xc5, 0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7,
-    0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7,
-    0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7,
-    0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7,
-    0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x46, 0xc7, 0x54, 0x37, 0x47, 0xc7,
-    0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7,
-    0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7,
-    0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7,
-    0x54, 0x37, 0x47, 0xc7, 0x54, 0x37, 0x47, 0xc7, 0x53, 0x37, 0x47, 0xc7, 0x53, 0x37, 0x47, 0xc7,
-    0x54, 0x37, 0x47, 0xc7, 0x54, 0x38, 0x47, 0xc5, 0x54, 0x38, 0x47, 0xc5, 0x54, 0x38, 0x47, 0xc5,
-    0x53, 0x34, 0x45, 0xc9, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-};
-
-#endif
@@ -1,4175 +0,0 @@
-// THIS FILE WAS AUTOGENERATED BY:
-// python3 scripts/res2header.py res/textures/pipe_bot.png res/textures/pipe_bot.h
-#ifndef TEXTURES_PIPE_BOT_H_INCLUDED
-#define TEXTURES_PIPE_BOT_H_INCLUDED
-
-#include "texture.h"
-
-static const char TEXTURE_PIPE_BOT_PATH[] = "res/textures/pipe_bot.png";
-static const int TEXTURE_PIPE_BOT_FORMAT = TEXTURE_FORMAT_RGBA;
-static const long TEXTURE_PIPE_BOT_WIDTH = 52;
-static const long TEXTURE_PIPE_BOT_HEIGHT = 320;
-static const unsigned char TEXTURE_PIPE_BOT_PIXELS[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x50, 0xff, 0x95, 0xb8, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x50, 0xff, 0x95, 0xb8, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x69, 0xff, 0xb5, 0xd3, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x69, 0xff, 0xb5, 0xd3, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7c, 0xff, 0xd1, 0xed, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x90, 0x30, 0xff, 0x69, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7c, 0xff, 0xd1, 0xed, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x90, 0x30, 0xff, 0x69, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x50, 0xff, 0x95, 0xb8, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x50, 0xff, 0x95, 0xb8, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x69, 0xff, 0xb5, 0xd3, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x69, 0xff, 0xb5, 0xd3, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7c, 0xff, 0xd1, 0xed, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x90, 0x30, 0xff, 0x69, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7c, 0xff, 0xd1, 0xed, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x90, 0x30, 0xff, 0x69, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x69, 0xff, 0xb5, 0xd3, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x69, 0xff, 0xb5, 0xd3, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7c, 0xff, 0xd1, 0xed, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x90, 0x30, 0xff, 0x69, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7c, 0xff, 0xd1, 0xed, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x90, 0x30, 0xff, 0x69, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x50, 0xff, 0x95, 0xb8, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x50, 0xff, 0x95, 0xb8, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff, 0x56, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x74, 0xff, 0xc4, 0xe0, 0x74, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x74, 0xff, 0xc3, 0xe0, 0x74, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5d, 0xff, 0xa4, 0xc5, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x69, 0xff, 0xb5, 0xd3, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x69, 0xff, 0xb5, 0xd3, 0x69, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7c, 0xff, 0xd1, 0xed, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x90, 0x30, 0xff, 0x69, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7c, 0xff, 0xd1, 0xed, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x50, 0xff, 0x94, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x44, 0xff, 0x84, 0xaa, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x90, 0x30, 0xff, 0x69, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xaa, 0x44, 0xff, 0x85, 0xaa, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x50, 0xff, 0x95, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x50, 0xff, 0x95, 0xb8, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x69, 0xff, 0xb4, 0xd3, 0x69, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5d, 0xff, 0xa5, 0xc5, 0x5d, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x31, 0xff, 0x69, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x31, 0xff, 0x69, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x86, 0xff, 0xdc, 0xf6, 0x86, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x86, 0xff, 0xdc, 0xf6, 0x86, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xed, 0x7d, 0xff, 0xd0, 0xed, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x51, 0xff, 0x95, 0xb7, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x88, 0x28, 0xff, 0x5d, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x44, 0xff, 0x85, 0xa9, 0x44, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf5, 0x85, 0xff, 0xdc, 0xf5, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x88, 0x28, 0xff, 0x5e, 0x88, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x74, 0xff, 0xc4, 0xe1, 0x74, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xc3, 0xe1, 0x74, 0xff, 0xc3, 0xe1, 0x74, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdb, 0xf6, 0x85, 0xff, 0xdb, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdb, 0xf5, 0x85, 0xff, 0xdb, 0xf5, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x94, 0xb7, 0x51, 0xff, 0x94, 0xb7, 0x51, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa5, 0xc6, 0x5c, 0xff, 0xa5, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xa9, 0x44, 0xff, 0x84, 0xa9, 0x44, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7c, 0xff, 0xd1, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb5, 0xd4, 0x69, 0xff, 0xb5, 0xd4, 0x69, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x76, 0x9d, 0x3a, 0xff, 0x76, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0xa4, 0xc6, 0x5c, 0xff, 0xa4, 0xc6, 0x5c, 0xff, 0xb4, 0xd4, 0x69, 0xff, 0xb4, 0xd4, 0x69, 0xff,
-    0xc4, 0xe0, 0x73, 0xff, 0xc4, 0xe0, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0x85, 0xaa, 0x45, 0xff, 0x85, 0xaa, 0x45, 0xff, 0x75, 0x9c, 0x3a, 0xff, 0x75, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x31, 0xff, 0x68, 0x91, 0x31, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x86, 0xff, 0xdc, 0xf6, 0x86, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc5, 0x5c, 0xff, 0xa5, 0xc5, 0x5c, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xd0, 0xec, 0x7c, 0xff, 0xd0, 0xec, 0x7c, 0xff,
-    0xdc, 0xf6, 0x86, 0xff, 0xdc, 0xf6, 0x86, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xb4, 0xd4, 0x68, 0xff, 0xb4, 0xd4, 0x68, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xa9, 0x45, 0xff, 0x84, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x3a, 0xff, 0x76, 0x9c, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5e, 0x87, 0x28, 0xff, 0x5e, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x86, 0xff, 0xdc, 0xf6, 0x86, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x95, 0xb7, 0x50, 0xff, 0x95, 0xb7, 0x50, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb5, 0xd4, 0x68, 0xff, 0xb5, 0xd4, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x86, 0xff, 0xdc, 0xf6, 0x86, 0xff, 0xd0, 0xec, 0x7d, 0xff, 0xd0, 0xec, 0x7d, 0xff,
-    0xc3, 0xe0, 0x73, 0xff, 0xc3, 0xe0, 0x73, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xa4, 0xc5, 0x5c, 0xff, 0xa4, 0xc5, 0x5c, 0xff, 0x94, 0xb8, 0x51, 0xff, 0x94, 0xb8, 0x51, 0xff,
-    0x85, 0xa9, 0x45, 0xff, 0x85, 0xa9, 0x45, 0xff, 0x76, 0x9c, 0x39, 0xff, 0x76, 0x9c, 0x39, 0xff,
-    0x69, 0x91, 0x30, 0xff, 0x69, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x1e, 0x9b, 0x38, 0x00, 0x1e, 0x9b, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x95, 0xb8, 0x51, 0xff, 0x95, 0xb8, 0x51, 0xff,
-    0xa5, 0xc6, 0x5d, 0xff, 0xa5, 0xc6, 0x5d, 0xff, 0xb4, 0xd3, 0x68, 0xff, 0xb4, 0xd3, 0x68, 0xff,
-    0xc4, 0xe1, 0x73, 0xff, 0xc4, 0xe1, 0x73, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff,
-    0xdc, 0xf6, 0x85, 0xff, 0xdc, 0xf6, 0x85, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xc3, 0xe1, 0x73, 0xff, 0xc3, 0xe1, 0x73, 0xff, 0xb5, 0xd3, 0x68, 0xff, 0xb5, 0xd3, 0x68, 0xff,
-    0xa4, 0xc6, 0x5d, 0xff, 0xa4, 0xc6, 0x5d, 0xff, 0x94, 0xb7, 0x50, 0xff, 0x94, 0xb7, 0x50, 0xff,
-    0x84, 0xaa, 0x45, 0xff, 0x84, 0xaa, 0x45, 0xff, 0x75, 0x9d, 0x3a, 0xff, 0x75, 0x9d, 0x3a, 0xff,
-    0x68, 0x91, 0x30, 0xff, 0x68, 0x91, 0x30, 0xff, 0x5d, 0x87, 0x28, 0xff, 0x5d, 0x87, 0x28, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x02, 0xfd, 0x37, 0x00, 0x02, 0xfd, 0x37, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x02, 0xfd, 0x37, 0x00, 0x02, 0xfd, 0x37, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x02, 0xfd, 0x37, 0x00, 0x02, 0xfd, 0x37, 0x00,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd2, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xdf, 0xf9, 0x88, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xd8, 0xf3, 0x83, 0xff, 0xd8, 0xf3, 0x83, 0xff, 0xd2, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe5, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x6a, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x97, 0xba, 0x52, 0xff, 0x97, 0xba, 0x52, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x82, 0xa7, 0x43, 0xff, 0x82, 0xa7, 0x43, 0xff,
-    0x79, 0xa0, 0x3d, 0xff, 0x79, 0xa0, 0x3d, 0xff, 0x6f, 0x98, 0x36, 0xff, 0x6f, 0x98, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x60, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x25, 0xff, 0x5a, 0x85, 0x25, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd2, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xdf, 0xf9, 0x88, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xd8, 0xf3, 0x83, 0xff, 0xd8, 0xf3, 0x83, 0xff, 0xd2, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe5, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x6a, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x97, 0xba, 0x52, 0xff, 0x97, 0xba, 0x52, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x82, 0xa7, 0x43, 0xff, 0x82, 0xa7, 0x43, 0xff,
-    0x79, 0xa0, 0x3d, 0xff, 0x79, 0xa0, 0x3d, 0xff, 0x6f, 0x98, 0x36, 0xff, 0x6f, 0x98, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x60, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x25, 0xff, 0x5a, 0x85, 0x25, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xd8, 0xf3, 0x83, 0xff, 0xd8, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf8, 0x88, 0xff, 0xdf, 0xf8, 0x88, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xd2, 0xed, 0x7d, 0xff, 0xd2, 0xed, 0x7d, 0xff,
-    0xc9, 0xe5, 0x78, 0xff, 0xc9, 0xe5, 0x78, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x69, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x52, 0xff, 0x98, 0xba, 0x52, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x82, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0x9f, 0x3d, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x70, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd1, 0xec, 0x7d, 0xff, 0xd1, 0xec, 0x7d, 0xff,
-    0xd8, 0xf3, 0x83, 0xff, 0xd8, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xdf, 0xf8, 0x88, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xd2, 0xed, 0x7d, 0xff, 0xd2, 0xed, 0x7d, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe5, 0x78, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x69, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x52, 0xff, 0x98, 0xba, 0x52, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd2, 0xed, 0x7d, 0xff, 0xd2, 0xed, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf3, 0x82, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x53, 0xff, 0x97, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd2, 0xed, 0x7d, 0xff, 0xd2, 0xed, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf3, 0x82, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x53, 0xff, 0x97, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf3, 0x82, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x53, 0xff, 0x97, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf3, 0x82, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x53, 0xff, 0x97, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd2, 0xec, 0x7d, 0xff, 0xd2, 0xec, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf3, 0x82, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x53, 0xff, 0x97, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd2, 0xec, 0x7d, 0xff, 0xd2, 0xec, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf8, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf3, 0x82, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x53, 0xff, 0x97, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd1, 0xed, 0x7e, 0xff,
-    0xd8, 0xf4, 0x83, 0xff, 0xd8, 0xf4, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd6, 0xf3, 0x82, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x53, 0xff, 0x97, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd1, 0xed, 0x7e, 0xff,
-    0xd8, 0xf4, 0x83, 0xff, 0xd8, 0xf4, 0x83, 0xff, 0xd7, 0xf9, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa1, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x98, 0xba, 0x53, 0xff, 0x97, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x6f, 0x97, 0x36, 0xff, 0x70, 0x97, 0x36, 0xff,
-    0x68, 0x90, 0x30, 0xff, 0x68, 0x90, 0x30, 0xff, 0x61, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x85, 0x26, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xd8, 0xf3, 0x83, 0xff, 0xd8, 0xf3, 0x83, 0xff, 0xdf, 0xf8, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xe0, 0xf9, 0x87, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf4, 0x83, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd2, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc4, 0x5b, 0xff, 0xa2, 0xc4, 0x5b, 0xff, 0x98, 0xba, 0x53, 0xff, 0x98, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x82, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x70, 0x97, 0x35, 0xff, 0x70, 0x97, 0x35, 0xff,
-    0x67, 0x91, 0x2f, 0xff, 0x67, 0x91, 0x2f, 0xff, 0x61, 0x89, 0x2a, 0xff, 0x61, 0x89, 0x2a, 0xff,
-    0x5a, 0x84, 0x25, 0xff, 0x5a, 0x85, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd1, 0xed, 0x7d, 0xff, 0xd1, 0xed, 0x7d, 0xff,
-    0xd8, 0xf3, 0x83, 0xff, 0xd8, 0xf3, 0x83, 0xff, 0xdf, 0xf8, 0x87, 0xff, 0xdf, 0xf8, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x88, 0xff, 0xdf, 0xf9, 0x88, 0xff,
-    0xd9, 0xf4, 0x83, 0xff, 0xd9, 0xf4, 0x83, 0xff, 0xd1, 0xed, 0x7e, 0xff, 0xd1, 0xed, 0x7e, 0xff,
-    0xc9, 0xe5, 0x77, 0xff, 0xc9, 0xe6, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x69, 0xff, 0xb6, 0xd5, 0x69, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc4, 0x5b, 0xff, 0xa2, 0xc4, 0x5b, 0xff, 0x98, 0xba, 0x53, 0xff, 0x98, 0xba, 0x53, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x82, 0xa8, 0x44, 0xff, 0x82, 0xa8, 0x44, 0xff,
-    0x79, 0xa0, 0x3c, 0xff, 0x79, 0xa0, 0x3c, 0xff, 0x70, 0x97, 0x35, 0xff, 0x70, 0x97, 0x35, 0xff,
-    0x67, 0x91, 0x2f, 0xff, 0x67, 0x91, 0x2f, 0xff, 0x61, 0x89, 0x2a, 0xff, 0x61, 0x89, 0x2a, 0xff,
-    0x5a, 0x84, 0x25, 0xff, 0x5a, 0x84, 0x25, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd2, 0xed, 0x7d, 0xff, 0xd2, 0xed, 0x7d, 0xff,
-    0xd8, 0xf4, 0x83, 0xff, 0xd8, 0xf4, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf8, 0x87, 0xff, 0xdf, 0xf8, 0x87, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xd2, 0xec, 0x7d, 0xff, 0xd2, 0xec, 0x7d, 0xff,
-    0xca, 0xe5, 0x77, 0xff, 0xca, 0xe5, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x6a, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x97, 0xba, 0x52, 0xff, 0x97, 0xba, 0x52, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x83, 0xa8, 0x44, 0xff,
-    0x79, 0x9f, 0x3d, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x70, 0x98, 0x36, 0xff, 0x70, 0x98, 0x36, 0xff,
-    0x68, 0x90, 0x2f, 0xff, 0x68, 0x90, 0x2f, 0xff, 0x60, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x84, 0x26, 0xff, 0x5a, 0x84, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xd2, 0xed, 0x7d, 0xff, 0xd2, 0xed, 0x7d, 0xff,
-    0xd8, 0xf4, 0x83, 0xff, 0xd8, 0xf4, 0x83, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf8, 0x87, 0xff, 0xdf, 0xf8, 0x87, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xd2, 0xec, 0x7d, 0xff, 0xd2, 0xec, 0x7d, 0xff,
-    0xca, 0xe5, 0x77, 0xff, 0xca, 0xe5, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x6a, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x97, 0xba, 0x52, 0xff, 0x97, 0xba, 0x52, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x83, 0xa8, 0x44, 0xff,
-    0x79, 0x9f, 0x3d, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x70, 0x98, 0x36, 0xff, 0x70, 0x98, 0x36, 0xff,
-    0x68, 0x90, 0x2f, 0xff, 0x68, 0x90, 0x2f, 0xff, 0x60, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x84, 0x26, 0xff, 0x5a, 0x84, 0x26, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff,
-    0x55, 0x80, 0x22, 0xff, 0x55, 0x80, 0x22, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xca, 0xe5, 0x77, 0xff, 0xca, 0xe5, 0x77, 0xff, 0xd2, 0xec, 0x7d, 0xff, 0xd2, 0xec, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf8, 0x87, 0xff, 0xdf, 0xf8, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xd8, 0xf4, 0x83, 0xff, 0xd8, 0xf4, 0x83, 0xff, 0xd2, 0xed, 0x7d, 0xff, 0xd2, 0xed, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xd2, 0xec, 0x7d, 0xff, 0xd2, 0xec, 0x7d, 0xff,
-    0xca, 0xe5, 0x77, 0xff, 0xca, 0xe5, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x6a, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x97, 0xba, 0x52, 0xff, 0x97, 0xba, 0x52, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x83, 0xa8, 0x44, 0xff,
-    0x79, 0x9f, 0x3d, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x70, 0x98, 0x36, 0xff, 0x70, 0x98, 0x36, 0xff,
-    0x68, 0x90, 0x2f, 0xff, 0x68, 0x90, 0x2f, 0xff, 0x60, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x84, 0x26, 0xff, 0x5a, 0x84, 0x26, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xca, 0xe5, 0x77, 0xff, 0xca, 0xe5, 0x77, 0xff, 0xd2, 0xec, 0x7d, 0xff, 0xd2, 0xec, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xdf, 0xf8, 0x87, 0xff, 0xdf, 0xf8, 0x87, 0xff,
-    0xe4, 0xfd, 0x8b, 0xff, 0xe4, 0xfd, 0x8b, 0xff, 0xdf, 0xf9, 0x87, 0xff, 0xdf, 0xf9, 0x87, 0xff,
-    0xd8, 0xf4, 0x83, 0xff, 0xd8, 0xf4, 0x83, 0xff, 0xd2, 0xed, 0x7d, 0xff, 0xd2, 0xed, 0x7d, 0xff,
-    0xd9, 0xf3, 0x83, 0xff, 0xd9, 0xf3, 0x83, 0xff, 0xd2, 0xec, 0x7d, 0xff, 0xd2, 0xec, 0x7d, 0xff,
-    0xca, 0xe5, 0x77, 0xff, 0xca, 0xe5, 0x77, 0xff, 0xc0, 0xdd, 0x71, 0xff, 0xc0, 0xdd, 0x71, 0xff,
-    0xb6, 0xd5, 0x6a, 0xff, 0xb6, 0xd5, 0x6a, 0xff, 0xac, 0xcc, 0x62, 0xff, 0xac, 0xcc, 0x62, 0xff,
-    0xa2, 0xc3, 0x5a, 0xff, 0xa2, 0xc3, 0x5a, 0xff, 0x97, 0xba, 0x52, 0xff, 0x97, 0xba, 0x52, 0xff,
-    0x8d, 0xb1, 0x4b, 0xff, 0x8d, 0xb1, 0x4b, 0xff, 0x83, 0xa8, 0x44, 0xff, 0x83, 0xa8, 0x44, 0xff,
-    0x79, 0x9f, 0x3d, 0xff, 0x79, 0x9f, 0x3d, 0xff, 0x70, 0x98, 0x36, 0xff, 0x70, 0x98, 0x36, 0xff,
-    0x68, 0x90, 0x2f, 0xff, 0x68, 0x90, 0x2f, 0xff, 0x60, 0x8a, 0x2a, 0xff, 0x60, 0x8a, 0x2a, 0xff,
-    0x5a, 0x84, 0x26, 0xff, 0x5a, 0x84, 0x26, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-    0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff,
-};
-
-#endif
@@ -0,0 +1,483 @@
+import argparse
+import io
+import re
+import sys
+
+# Generate call counting and timing wrappers for every OpenGL function in
+# the OPENGL_FUNCTIONS and OPENGL_DEBUG_FUNCTIONS lists of src/opengl.h.
+# Signatures come from the prototypes in vendor/include/GL/glcorearb.h.
+# The output is included by src/opengl.c when building with
+# -DOPENGL_PROFILE.
+#
+# With --null it instead generates the stubs of the null backend in
+# src/glnull.c: each records its call and arguments and does nothing else.
+# With --trace it generates the capture wrappers and the replay decoder of
+# src/gltrace.c.
+
+
+def read_functions(opengl_header):
+    with open(opengl_header) as f:
+        text = f.read()
+    return re.findall(r'OPENGL_FUNCTION\((gl\w+),\s*(\w+)\)', text)
+
+
+def read_prototypes(gl_header):
+    with open(gl_header) as f:
+        text = f.read()
+    prototypes = {}
+    for ret, name, params in re.findall(r'GLAPI\s+(.+?)\s*APIENTRY\s+(gl\w+)\s*\((.*?)\);', text):
+        prototypes[name] = (re.sub(r'\s*\*', '*', ret.strip()), params.strip())
+    return prototypes
+
+
+def param_names(params):
+    if params in ['', 'void']:
+        return []
+    names = []
+    for param in params.split(','):
+        match = re.search(r'(\w+)\s*(\[\d*\])?$', param.strip())
+        if match is None:
+            raise SystemExit('Cannot parse parameter: {}'.format(param))
+        names.append(match.group(1))
+    return names
+
+
+def glwrap(opengl_header, gl_header):
+    functions = read_functions(opengl_header)
+    prototypes = read_prototypes(gl_header)
+
+    s = io.StringIO()
+    s.write('// THIS FILE WAS AUTOGENERATED BY:\n')
+    s.write('// python3 ' + ' '.join(sys.argv) + '\n')
+    s.write('#ifndef OPENGL_PROFILE_H_INCLUDED\n')
+    s.write('#define OPENGL_PROFILE_H_INCLUDED\n')
+    s.write('\n')
+    s.write('// expects opengl_profile_clock() and opengl_profile_add(index, start)\n')
+    s.write('\n')
+
+    s.write('enum {\n')
+    for name, _ in functions:
+        s.write('    OPENGL_PROFILE_{},\n'.format(name.upper()))
+    s.write('    OPENGL_PROFILE_FUNCTIONS,\n')
+    s.write('};\n')
+    s.write('\n')
+
+    s.write('static const char* const OPENGL_PROFILE_NAMES[OPENGL_PROFILE_FUNCTIONS] = {\n')
+    for name, _ in functions:
+        s.write('    "{}",\n'.format(name))
+    s.write('};\n')
+
+    for name, func_type in functions:
+        if name not in prototypes:
+            raise SystemExit('No prototype for {} in {}'.format(name, gl_header))
+        ret, params = prototypes[name]
+        args = ', '.join(param_names(params))
+        index = 'OPENGL_PROFILE_{}'.format(name.upper())
+
+        s.write('\n')
+        s.write('static {} {}_driver = NULL;\n'.format(func_type, name))
+        s.write('static {} APIENTRY\n'.format(ret))
+        s.write('{}_profiled({})\n'.format(name, params))
+        s.write('{\n')
+        s.write('    double start = opengl_profile_clock();\n')
+        if ret == 'void':
+            s.write('    {}_driver({});\n'.format(name, args))
+            s.write('    opengl_profile_add({}, start);\n'.format(index))
+        else:
+            s.write('    {} result = {}_driver({});\n'.format(ret, name, args))
+            s.write('    opengl_profile_add({}, start);\n'.format(index))
+            s.write('    return result;\n')
+        s.write('}\n')
+
+    s.write('\n')
+    s.write('// route every loaded function through its wrapper\n')
+    s.write('static void\n')
+    s.write('opengl_profile_install(void)\n')
+    s.write('{\n')
+    for name, _ in functions:
+        s.write('    {0}_driver = {0};\n'.format(name))
+        s.write('    {0} = {0}_profiled;\n'.format(name))
+    s.write('}\n')
+    s.write('\n')
+    s.write('#endif\n')
+
+    return s.getvalue()
+
+
+# Functions whose null stub hands over to glnull_<name> in src/glnull.c
+# after recording, because the caller needs a believable answer.
+NULL_CUSTOM = [
+    'glGetString',
+    'glGetStringi',
+    'glGetIntegerv',
+    'glGetShaderiv',
+    'glGetShaderInfoLog',
+    'glGetProgramiv',
+    'glGetProgramInfoLog',
+    'glMapBufferRange',
+    'glUnmapBuffer',
+    'glGetQueryObjectiv',
+    'glCheckFramebufferStatus',
+]
+
+
+def param_types(params):
+    if params in ['', 'void']:
+        return []
+    return [re.sub(r'\s*\w+\s*(\[\d*\])?$', '', param.strip()) for param in params.split(',')]
+
+
+def null_arg(name, param_type):
+    # every argument is kept as a double: exact for all the integer and
+    # float types GL takes, pointers are kept as addresses (or offsets)
+    if '*' in param_type or param_type in ['GLDEBUGPROC']:
+        return '(double)(uintptr_t){}'.format(name)
+    return '(double){}'.format(name)
+
+
+def glnull(opengl_header, gl_header):
+    functions = read_functions(opengl_header)
+    prototypes = read_prototypes(gl_header)
+
+    s = io.StringIO()
+    s.write('// THIS FILE WAS AUTOGENERATED BY:\n')
+    s.write('// python3 ' + ' '.join(sys.argv) + '\n')
+    s.write('#ifndef OPENGL_NULL_H_INCLUDED\n')
+    s.write('#define OPENGL_NULL_H_INCLUDED\n')
+    s.write('\n')
+    s.write('// expects glnull_record(function, args, count), glnull_generate(n, names),\n')
+    s.write('// glnull_create() and glnull_<name> for each of these:\n')
+    for name in NULL_CUSTOM:
+        s.write('//   {}\n'.format(name))
+    s.write('\n')
+
+    s.write('enum {\n')
+    for name, _ in functions:
+        s.write('    OPENGL_NULL_{},\n'.format(name.upper()))
+    s.write('    OPENGL_NULL_FUNCTIONS,\n')
+    s.write('};\n')
+    s.write('\n')
+
+    s.write('static const char* const OPENGL_NULL_NAMES[OPENGL_NULL_FUNCTIONS] = {\n')
+    for name, _ in functions:
+        s.write('    "{}",\n'.format(name))
+    s.write('};\n')
+
+    for name, _ in functions:
+        if name not in prototypes:
+            raise SystemExit('No prototype for {} in {}'.format(name, gl_header))
+        ret, params = prototypes[name]
+        names = param_names(params)
+        types = param_types(params)
+        index = 'OPENGL_NULL_{}'.format(name.upper())
+
+        s.write('\n')
+        s.write('static {} APIENTRY\n'.format(ret))
+        s.write('{}_null({})\n'.format(name, params))
+        s.write('{\n')
+        if names:
+            args = ', '.join(null_arg(n, t) for n, t in zip(names, types))
+            s.write('    double args[] = {{ {} }};\n'.format(args))
+            s.write('    glnull_record({}, args, {});\n'.format(index, len(names)))
+        else:
+            s.write('    glnull_record({}, NULL, 0);\n'.format(index))
+
+        if name in NULL_CUSTOM:
+            call = 'glnull_{}({});'.format(name, ', '.join(names))
+            s.write('    {}{}\n'.format('' if ret == 'void' else 'return ', call))
+        elif re.match(r'glGen[A-Z]\w*s$', name) and len(names) == 2:
+            s.write('    glnull_generate({}, {});\n'.format(names[0], names[1]))
+        elif name.startswith('glCreate') and ret == 'GLuint':
+            s.write('    return glnull_create();\n')
+        elif ret != 'void':
+            s.write('    return 0;\n')
+        s.write('}\n')
+
+    s.write('\n')
+    s.write('static const opengl_proc OPENGL_NULL_PROCS[OPENGL_NULL_FUNCTIONS] = {\n')
+    for name, _ in functions:
+        s.write('    (opengl_proc){}_null,\n'.format(name))
+    s.write('};\n')
+    s.write('\n')
+    s.write('#endif\n')
+
+    return s.getvalue()
+
+
+# Trace capture and replay. Every call is written as its function number,
+# its scalar arguments in their native size, then the data behind its
+# pointers (see src/gltrace.h). Queries and other calls that only write
+# through pointers are left out, they don't change what is drawn.
+
+# written and replayed by hand in src/gltrace.c
+TRACE_CUSTOM = ['glShaderSource', 'glMapBufferRange', 'glUnmapBuffer']
+
+# only useful with a live driver
+TRACE_SKIP = ['glCheckFramebufferStatus', 'glDebugMessageCallback', 'glDebugMessageControl']
+
+# only kept inside the traced frames, state changes are kept everywhere
+TRACE_FRAME_ONLY = ['glClear', 'glDrawArrays', 'glDrawArraysInstanced', 'glFinish', 'glBeginQuery', 'glEndQuery']
+
+# bytes behind each const pointer argument
+TRACE_PAYLOADS = {
+    ('glUniform3fv', 'value'): 'count * 3 * sizeof(GLfloat)',
+    ('glUniformMatrix4fv', 'value'): 'count * 16 * sizeof(GLfloat)',
+    ('glGetUniformLocation', 'name'): 'strlen(name) + 1',
+    ('glGetUniformBlockIndex', 'uniformBlockName'): 'strlen(uniformBlockName) + 1',
+    ('glBufferData', 'data'): 'size',
+    ('glBufferSubData', 'data'): 'size',
+    ('glTexImage2D', 'pixels'): 'gltrace_image_size(width, height, format, type)',
+}
+
+# pointer arguments that are really offsets into a bound buffer
+TRACE_OFFSETS = [('glVertexAttribPointer', 'pointer')]
+
+# GLuint arguments that name objects, which replay renames
+TRACE_NAMES = {
+    'buffer': 'GLTRACE_BUFFER',
+    'buffers': 'GLTRACE_BUFFER',
+    'texture': 'GLTRACE_TEXTURE',
+    'textures': 'GLTRACE_TEXTURE',
+    'program': 'GLTRACE_PROGRAM',
+    'shader': 'GLTRACE_PROGRAM',
+    'array': 'GLTRACE_VERTEX_ARRAY',
+    'arrays': 'GLTRACE_VERTEX_ARRAY',
+    'id': 'GLTRACE_QUERY',
+    'ids': 'GLTRACE_QUERY',
+    'framebuffer': 'GLTRACE_FRAMEBUFFER',
+    'framebuffers': 'GLTRACE_FRAMEBUFFER',
+    'renderbuffer': 'GLTRACE_RENDERBUFFER',
+    'renderbuffers': 'GLTRACE_RENDERBUFFER',
+}
+
+# functions whose result names something, and what
+TRACE_RESULTS = {
+    'glCreateShader': 'GLTRACE_PROGRAM',
+    'glCreateProgram': 'GLTRACE_PROGRAM',
+}
+
+
+def trace_kind(name, params):
+    types = param_types(params)
+    if name in TRACE_CUSTOM:
+        return 'custom'
+    if re.match(r'glGen[A-Z]\w*s$', name) and len(types) == 2:
+        return 'generate'
+    if name in TRACE_SKIP or name.startswith('glGetString'):
+        return 'skip'
+    if any('*' in t and not t.startswith('const') for t in types):
+        return 'skip'
+    return 'plain'
+
+
+def glwrap_trace(opengl_header, gl_header):
+    functions = read_functions(opengl_header)
+    prototypes = read_prototypes(gl_header)
+    for name, _ in functions:
+        if name not in prototypes:
+            raise SystemExit('No prototype for {} in {}'.format(name, gl_header))
+    traced = [(name, func_type) for name, func_type in functions
+              if trace_kind(name, prototypes[name][1]) != 'skip']
+
+    s = io.StringIO()
+    s.write('// THIS FILE WAS AUTOGENERATED BY:\n')
+    s.write('// python3 ' + ' '.join(sys.argv) + '\n')
+    s.write('#ifndef OPENGL_TRACE_H_INCLUDED\n')
+    s.write('#define OPENGL_TRACE_H_INCLUDED\n')
+    s.write('\n')
+    s.write('// expects the capture helpers gltrace_call, gltrace_put, gltrace_payload and\n')
+    s.write('// gltrace_image_size, the replay helpers gltrace_get, gltrace_get_payload,\n')
+    s.write('// gltrace_rename, gltrace_renamed, gltrace_relocate and gltrace_located, and\n')
+    s.write('// <name>_traced and gltrace_replay_<name> for each of these:\n')
+    for name in TRACE_CUSTOM:
+        s.write('//   {}\n'.format(name))
+    s.write('\n')
+
+    s.write('enum {\n')
+    for name, _ in traced:
+        s.write('    OPENGL_TRACE_{},\n'.format(name.upper()))
+    s.write('    OPENGL_TRACE_FUNCTIONS,\n')
+    s.write('};\n')
+    s.write('\n')
+
+    s.write('static const char* const OPENGL_TRACE_NAMES[OPENGL_TRACE_FUNCTIONS] = {\n')
+    for name, _ in traced:
+        s.write('    "{}",\n'.format(name))
+    s.write('};\n')
+    s.write('\n')
+
+    s.write('static const bool OPENGL_TRACE_FRAME_ONLY[OPENGL_TRACE_FUNCTIONS] = {\n')
+    for name, _ in traced:
+        if name in TRACE_FRAME_ONLY:
+            s.write('    [OPENGL_TRACE_{}] = true,\n'.format(name.upper()))
+    s.write('};\n')
+    s.write('\n')
+
+    for name, func_type in traced:
+        s.write('static {} {}_driver = NULL;\n'.format(func_type, name))
+    s.write('\n')
+
+    for name, _ in traced:
+        ret, params = prototypes[name]
+        if trace_kind(name, params) == 'custom':
+            s.write('static {} APIENTRY {}_traced({});\n'.format(ret, name, params))
+            s.write('static void gltrace_replay_{}(struct FlappyGLReplay* replay);\n'.format(name))
+
+    # capture
+    for name, _ in traced:
+        ret, params = prototypes[name]
+        kind = trace_kind(name, params)
+        if kind == 'custom':
+            continue
+        names = param_names(params)
+        types = param_types(params)
+        index = 'OPENGL_TRACE_{}'.format(name.upper())
+
+        s.write('\n')
+        s.write('static {} APIENTRY\n'.format(ret))
+        s.write('{}_traced({})\n'.format(name, params))
+        s.write('{\n')
+        call = '{}_driver({})'.format(name, ', '.join(names))
+        if ret == 'void':
+            s.write('    {};\n'.format(call))
+        else:
+            s.write('    {} result = {};\n'.format(ret, call))
+        s.write('    if (gltrace_call({})) {{\n'.format(index))
+        for n, t in zip(names, types):
+            if kind == 'generate' and '*' in t:
+                s.write('        gltrace_payload({}, {} * sizeof(GLuint));\n'.format(n, names[0]))
+            elif (name, n) in TRACE_OFFSETS:
+                s.write('        uint64_t {0}_offset = (uintptr_t){0};\n'.format(n))
+                s.write('        gltrace_put(&{0}_offset, sizeof({0}_offset));\n'.format(n))
+            elif t == 'const GLuint *':
+                s.write('        gltrace_payload({}, {} * sizeof(GLuint));\n'.format(n, names[0]))
+            elif '*' in t:
+                if (name, n) not in TRACE_PAYLOADS:
+                    raise SystemExit('No payload size for {} of {}'.format(n, name))
+                s.write('        gltrace_payload({}, {});\n'.format(n, TRACE_PAYLOADS[(name, n)]))
+            else:
+                s.write('        gltrace_put(&{0}, sizeof({0}));\n'.format(n))
+        if ret != 'void':
+            s.write('        gltrace_put(&result, sizeof(result));\n')
+        s.write('    }\n')
+        if ret != 'void':
+            s.write('    return result;\n')
+        s.write('}\n')
+
+    # replay
+    s.write('\n')
+    s.write('// decode and issue one call, with object names and uniform locations\n')
+    s.write('// translated to the ones this context handed out\n')
+    s.write('static void\n')
+    s.write('gltrace_replay_call(struct FlappyGLReplay* replay, int function)\n')
+    s.write('{\n')
+    s.write('    switch (function) {\n')
+    for name, _ in traced:
+        ret, params = prototypes[name]
+        kind = trace_kind(name, params)
+        names = param_names(params)
+        types = param_types(params)
+        s.write('    case OPENGL_TRACE_{}: {{\n'.format(name.upper()))
+        if kind == 'custom':
+            s.write('        gltrace_replay_{}(replay);\n'.format(name))
+            s.write('        break;\n')
+            s.write('    }\n')
+            continue
+
+        args = []
+        for n, t in zip(names, types):
+            if kind == 'generate' and '*' in t:
+                s.write('        const GLuint* {} = gltrace_get_payload(replay);\n'.format(n))
+                continue
+            if (name, n) in TRACE_OFFSETS:
+                s.write('        uint64_t {}_offset = 0;\n'.format(n))
+                s.write('        gltrace_get(replay, &{0}_offset, sizeof({0}_offset));\n'.format(n))
+                args.append('(const void*)(uintptr_t){}_offset'.format(n))
+            elif t == 'const GLuint *':
+                s.write('        const GLuint* {} = gltrace_get_payload(replay);\n'.format(n))
+                args.append('gltrace_renamed(replay, {}, {}, {})'.format(TRACE_NAMES[n], n, names[0]))
+            elif '*' in t:
+                s.write('        const void* {} = gltrace_get_payload(replay);\n'.format(n))
+                args.append(n)
+            else:
+                s.write('        {} {} = 0;\n'.format(t, n))
+                s.write('        gltrace_get(replay, &{0}, sizeof({0}));\n'.format(n))
+                if t == 'GLuint' and n in TRACE_NAMES:
+                    args.append('gltrace_rename(replay, {}, {})'.format(TRACE_NAMES[n], n))
+                elif t == 'GLint' and n == 'location':
+                    args.append('gltrace_relocate(replay, GLTRACE_LOCATION, replay->program, location)')
+                elif t == 'GLuint' and n == 'uniformBlockIndex':
+                    args.append('gltrace_relocate(replay, GLTRACE_BLOCK, program, uniformBlockIndex)')
+                else:
+                    args.append(n)
+
+        if name == 'glUseProgram':
+            s.write('        replay->program = program;\n')
+        if kind == 'generate':
+            kind_name = TRACE_NAMES[names[1]]
+            s.write('        if (replay->failed) break;\n')
+            s.write('        GLuint* {}_replayed = gltrace_renamed(replay, {}, NULL, {});\n'.format(names[1], kind_name, names[0]))
+            s.write('        {}({}, {}_replayed);\n'.format(name, names[0], names[1]))
+            s.write('        for (GLsizei i = 0; i < {}; i++) {{\n'.format(names[0]))
+            s.write('            gltrace_name(replay, {0}, {1}[i], {1}_replayed[i]);\n'.format(kind_name, names[1]))
+            s.write('        }\n')
+        elif ret != 'void':
+            s.write('        {} result = 0;\n'.format(ret))
+            s.write('        gltrace_get(replay, &result, sizeof(result));\n')
+            s.write('        if (replay->failed) break;\n')
+            s.write('        {} replayed = {}({});\n'.format(ret, name, ', '.join(args)))
+            if name in TRACE_RESULTS:
+                s.write('        gltrace_name(replay, {}, result, replayed);\n'.format(TRACE_RESULTS[name]))
+            elif name == 'glGetUniformLocation':
+                s.write('        gltrace_located(replay, GLTRACE_LOCATION, program, result, replayed);\n')
+            elif name == 'glGetUniformBlockIndex':
+                s.write('        gltrace_located(replay, GLTRACE_BLOCK, program, result, replayed);\n')
+            else:
+                raise SystemExit('Unknown result of {}'.format(name))
+        else:
+            s.write('        if (replay->failed) break;\n')
+            s.write('        {}({});\n'.format(name, ', '.join(args)))
+        s.write('        break;\n')
+        s.write('    }\n')
+    s.write('    }\n')
+    s.write('}\n')
+
+    s.write('\n')
+    s.write('// route every traced function through its wrapper\n')
+    s.write('static void\n')
+    s.write('opengl_trace_install(void)\n')
+    s.write('{\n')
+    for name, _ in traced:
+        s.write('    {0}_driver = {0};\n'.format(name))
+        s.write('    {0} = {0}_traced;\n'.format(name))
+    s.write('}\n')
+    s.write('\n')
+    s.write('static void\n')
+    s.write('opengl_trace_uninstall(void)\n')
+    s.write('{\n')
+    for name, _ in traced:
+        s.write('    {0} = {0}_driver;\n'.format(name))
+    s.write('}\n')
+    s.write('\n')
+    s.write('#endif\n')
+
+    return s.getvalue()
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Generate profiling wrappers for the OpenGL functions')
+    parser.add_argument('opengl_header', help='header with the OPENGL_FUNCTIONS list')
+    parser.add_argument('gl_header', help='glcorearb.h with the function prototypes')
+    parser.add_argument('output_header', help='output header file')
+    parser.add_argument('--null', action='store_true', help='generate the recording stubs of src/glnull.c instead')
+    parser.add_argument('--trace', action='store_true', help='generate the trace capture and replay of src/gltrace.c instead')
+    args = parser.parse_args()
+
+    if args.null:
+        header = glnull(args.opengl_header, args.gl_header)
+    elif args.trace:
+        header = glwrap_trace(args.opengl_header, args.gl_header)
+    else:
+        header = glwrap(args.opengl_header, args.gl_header)
+    with open(args.output_header, 'w') as f:
+        f.write(header)
@@ -102,15 +102,20 @@ def shader2header(resource_file):
     return s.getvalue()
 
 
-def texture2header(resource_file):
-    name, ext = os.path.splitext(os.path.basename(resource_file))
-
+def load_texture(resource_file):
     # load image and flip vertically to accommodate OpenGL's texcoord system
     texture = Image.open(resource_file)
     texture = texture.transpose(Image.FLIP_TOP_BOTTOM)
 
+    width, height = texture.size
+    return width, height, texture.mode, texture.tobytes()
+
+
+def texture2header(resource_file):
+    name, ext = os.path.splitext(os.path.basename(resource_file))
+    width, height, format, pixels = load_texture(resource_file)
+
     row_size = 0
-    format = texture.mode
     if format == 'RGB':
         row_size = 12
         format = 'TEXTURE_FORMAT_RGB'
@@ -120,9 +125,6 @@ def texture2header(resource_file):
     else:
         raise SystemExit('Unknown texture format: {}'.format(format))
 
-    width, height = texture.size
-    pixels = texture.tobytes()
-
     guard = 'TEXTURES_{}_H_INCLUDED'.format(name.upper())
 
     s = io.StringIO()
@@ -151,6 +153,214 @@ def texture2header(resource_file):
     return s.getvalue()
 
 
+# Atlas packing: an .atlas file lists one image per line (relative to the
+# .atlas file, '#' starts a comment). All images are packed into a single
+# RGBA texture and each one gets a texture_region with its texcoord rect.
+#
+# An image that matches an earlier one, as is or flipped, is not packed
+# again: its region reuses the earlier rect with the texcoords swapped.
+# Lossy sources are rarely bit-exact, so channels may differ by up to
+# ATLAS_TOLERANCE.
+#
+# Fully transparent borders are trimmed off, keeping one transparent texel
+# so filtering at the edge of the drawn part is unchanged, and the region
+# says which part of the image is left. Images may be stored rotated by 90
+# degrees when that packs tighter.
+
+ATLAS_PADDING = 1    # border pixels repeated around each image against filtering bleed
+ATLAS_TOLERANCE = 2  # max per-channel difference for a duplicate
+
+
+def to_rgba(mode, pixels):
+    if mode == 'RGBA':
+        return bytes(pixels)
+    elif mode == 'RGB':
+        rgba = bytearray(len(pixels) // 3 * 4)
+        rgba[0::4] = pixels[0::3]
+        rgba[1::4] = pixels[1::3]
+        rgba[2::4] = pixels[2::3]
+        rgba[3::4] = b'\xff' * (len(pixels) // 3)
+        return bytes(rgba)
+    else:
+        raise SystemExit('Unknown texture format: {}'.format(mode))
+
+
+def flip_pixels(width, height, pixels, flip_x, flip_y):
+    rows = [pixels[y * width * 4:(y + 1) * width * 4] for y in range(height)]
+    if flip_y:
+        rows.reverse()
+    if flip_x:
+        rows = [b''.join(row[x * 4:(x + 1) * 4] for x in reversed(range(width))) for row in rows]
+    return b''.join(rows)
+
+
+def same_pixels(a, b):
+    return len(a) == len(b) and all(abs(x - y) <= ATLAS_TOLERANCE for x, y in zip(a, b))
+
+
+def find_duplicate(image, packed):
+    width, height, pixels = image
+    for index, (w, h, p) in enumerate(packed):
+        if (w, h) != (width, height):
+            continue
+        for flip_x, flip_y in [(False, False), (False, True), (True, False), (True, True)]:
+            if same_pixels(flip_pixels(w, h, p, flip_x, flip_y), pixels):
+                return index, flip_x, flip_y
+    return None
+
+
+def trim_rect(width, height, pixels):
+    # bounds of the visible texels plus one transparent texel, as x0, y0, x1, y1
+    xs = [i // 4 % width for i in range(3, len(pixels), 4) if pixels[i] != 0]
+    ys = [i // 4 // width for i in range(3, len(pixels), 4) if pixels[i] != 0]
+    if not xs:
+        return 0, 0, width, height
+    return max(min(xs) - 1, 0), max(min(ys) - 1, 0), min(max(xs) + 2, width), min(max(ys) + 2, height)
+
+
+def crop_pixels(width, pixels, rect):
+    x0, y0, x1, y1 = rect
+    return b''.join(pixels[(y * width + x0) * 4:(y * width + x1) * 4] for y in range(y0, y1))
+
+
+def rotate_pixels(width, height, pixels):
+    # stored(x, y) = image(y, height - 1 - x), drawn back upright by a quarter turn
+    return b''.join(pixels[((height - 1 - x) * width + y) * 4:((height - 1 - x) * width + y + 1) * 4]
+                    for y in range(width) for x in range(height))
+
+
+def skyline_pack(sizes, width):
+    # bottom-left skyline: place each rect (tallest first) where it ends lowest
+    skyline = [0] * width
+    positions = [None] * len(sizes)
+    order = sorted(range(len(sizes)), key=lambda i: (-sizes[i][1], -sizes[i][0]))
+    for i in order:
+        w, h = sizes[i]
+        if w > width:
+            return None, None
+        best = None
+        for x in range(width - w + 1):
+            y = max(skyline[x:x + w])
+            if best is None or y < best[1]:
+                best = (x, y)
+        x, y = best
+        skyline[x:x + w] = [y + h] * w
+        positions[i] = best
+    return positions, max(skyline)
+
+
+def pack_rects(sizes):
+    # try every width between the widest image and all of them side by side,
+    # with each image as is or rotated
+    best = None
+    for turns in range(1 << len(sizes)):
+        rotated = [bool(turns >> i & 1) for i in range(len(sizes))]
+        oriented = [(h, w) if r else (w, h) for (w, h), r in zip(sizes, rotated)]
+        for width in range(max(w for w, _ in oriented), sum(w for w, _ in oriented) + 1):
+            positions, height = skyline_pack(oriented, width)
+            if positions is not None and (best is None or width * height < best[0] * best[1]):
+                best = (width, height, positions, rotated)
+    return best
+
+
+def atlas2header(resource_file):
+    name, ext = os.path.splitext(os.path.basename(resource_file))
+    base = os.path.dirname(resource_file)
+    with open(resource_file) as f:
+        images = [line.split('#')[0].strip() for line in f]
+    images = [image for image in images if image]
+
+    # collect the distinct images and how every listed image maps onto them
+    packed = []
+    regions = []
+    for image in images:
+        width, height, mode, pixels = load_texture(os.path.join(base, image))
+        pixels = to_rgba(mode, pixels)
+        duplicate = find_duplicate((width, height, pixels), packed)
+        if duplicate is None:
+            packed.append((width, height, pixels))
+            duplicate = (len(packed) - 1, False, False)
+        regions.append((os.path.splitext(image)[0], duplicate))
+
+    trims = [trim_rect(w, h, p) for w, h, p in packed]
+    pad = ATLAS_PADDING
+    sizes = [(x1 - x0 + 2 * pad, y1 - y0 + 2 * pad) for x0, y0, x1, y1 in trims]
+    atlas_width, atlas_height, positions, rotated = pack_rects(sizes)
+
+    # copy each image in, repeating its edge pixels into the padding
+    atlas = bytearray(atlas_width * atlas_height * 4)
+    for (w, h, pixels), trim, turned, (x0, y0) in zip(packed, trims, rotated, positions):
+        pixels = crop_pixels(w, pixels, trim)
+        w, h = trim[2] - trim[0], trim[3] - trim[1]
+        if turned:
+            pixels = rotate_pixels(w, h, pixels)
+            w, h = h, w
+        for y in range(-pad, h + pad):
+            src_y = min(max(y, 0), h - 1)
+            row = pixels[src_y * w * 4:(src_y + 1) * w * 4]
+            row = row[:4] * pad + row + row[-4:] * pad
+            start = ((y0 + pad + y) * atlas_width + x0) * 4
+            atlas[start:start + len(row)] = row
+
+    guard = 'TEXTURES_{}_H_INCLUDED'.format(name.upper())
+
+    s = io.StringIO()
+    s.write('// THIS FILE WAS AUTOGENERATED BY:\n')
+    s.write('// python3 ' + ' '.join(sys.argv) + '\n')
+    s.write('#ifndef {}\n'.format(guard))
+    s.write('#define {}\n'.format(guard))
+    s.write('\n')
+    s.write('#include "texture.h"\n')
+    s.write('\n')
+    s.write('static const char TEXTURE_{}_PATH[] = "{}";\n'.format(name.upper(), resource_file))
+    s.write('static const int TEXTURE_{}_FORMAT = TEXTURE_FORMAT_RGBA;\n'.format(name.upper()))
+    s.write('static const long TEXTURE_{}_WIDTH = {};\n'.format(name.upper(), atlas_width))
+    s.write('static const long TEXTURE_{}_HEIGHT = {};\n'.format(name.upper(), atlas_height))
+    s.write('\n')
+    for region_name, (index, flip_x, flip_y) in regions:
+        w, h, _ = packed[index]
+        tx0, ty0, tx1, ty1 = trims[index]
+        x, y = positions[index]
+        sw, sh = (ty1 - ty0, tx1 - tx0) if rotated[index] else (tx1 - tx0, ty1 - ty0)
+        u0, u1 = (x + pad) / atlas_width, (x + pad + sw) / atlas_width
+        v0, v1 = (y + pad) / atlas_height, (y + pad + sh) / atlas_height
+
+        # the kept part of the image, mirrored along with a flipped duplicate
+        x0, x1 = tx0 / w, tx1 / w
+        y0, y1 = ty0 / h, ty1 / h
+        if flip_x:
+            x0, x1 = 1.0 - x1, 1.0 - x0
+        if flip_y:
+            y0, y1 = 1.0 - y1, 1.0 - y0
+
+        # a rotated image runs along v for x and against u for y
+        if flip_x:
+            if rotated[index]:
+                v0, v1 = v1, v0
+            else:
+                u0, u1 = u1, u0
+        if flip_y:
+            if rotated[index]:
+                u0, u1 = u1, u0
+            else:
+                v0, v1 = v1, v0
+        s.write('static const struct texture_region TEXTURE_{}_{} = {{ {:f}f, {:f}f, {:f}f, {:f}f, {:f}f, {:f}f, {:f}f, {:f}f, {} }};\n'.format(
+            name.upper(), region_name.upper(), u0, v0, u1, v1, x0, y0, x1, y1, 'true' if rotated[index] else 'false'))
+    s.write('\n')
+    s.write('static const unsigned char TEXTURE_{}_PIXELS[] = {{\n'.format(name.upper()))
+    for group in grouper(atlas, 16):
+        group = list(group)
+        while None in group:
+            group.remove(None)
+        line = ', '.join('0x{:02x}'.format(b) for b in group)
+        s.write('    {},\n'.format(line))
+    s.write('};\n')
+    s.write('\n')
+    s.write('#endif\n')
+
+    return s.getvalue()
+
+
 def res2header(resource_file):
     _, ext = os.path.splitext(os.path.basename(resource_file))
     if ext in ['.obj']:
@@ -159,6 +369,8 @@ def res2header(resource_file):
         return shader2header(resource_file)
     elif ext in ['.jpg', '.png']:
         return texture2header(resource_file)
+    elif ext in ['.atlas']:
+        return atlas2header(resource_file)
     else:
         raise SystemExit('Unknown resource type: {}'.format(resource_file))
 
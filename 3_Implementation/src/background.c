@@ -0,0 +1,111 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "background.h"
+#include "frame.h"
+#include "glstate.h"
+#include "opengl.h"
+#include "shader.h"
+
+#include "shaders/background_frag.h"
+#include "shaders/background_vert.h"
+
+enum {
+    BACKGROUND_VERTICES = 6,  // one quad, built from gl_VertexID
+};
+
+// Copy a shader source with BACKGROUND_COUNT defined after its #version
+// line. Every layer count gets straight-line shaders instead of branching
+// on a uniform per pixel.
+static char*
+background_source(const char* source, long count)
+{
+    const char* body = strchr(source, '\n');
+    assert(body != NULL);
+    body++;
+
+    long version = body - source;
+    long size = strlen(source) + 64;
+    char* out = malloc(size);
+    if (out == NULL) return NULL;
+
+    snprintf(out, size, "%.*s#define BACKGROUND_COUNT %ld\n%s", (int)version, source, count, body);
+    return out;
+}
+
+bool
+background_create(struct FlappyBackground* background, float width, float height,
+    const struct BackgroundLayer* layers, long count)
+{
+    assert(background != NULL);
+    assert(layers != NULL);
+    assert(count > 0 && count <= BACKGROUND_LAYERS);
+
+    memset(background, 0, sizeof(*background));
+    background->count = count;
+
+    char* vert = background_source(SHADER_BACKGROUND_VERT_SOURCE, count);
+    char* frag = background_source(SHADER_BACKGROUND_FRAG_SOURCE, count);
+    if (vert != NULL && frag != NULL) {
+        background->shader = shader_compile_and_link(vert, frag);
+    }
+    free(vert);
+    free(frag);
+    if (background->shader == 0) {
+        fprintf(stderr, "failed to create background shader\n");
+        return false;
+    }
+    frame_program_bind(background->shader);
+    background->uniform_layer = glGetUniformLocation(background->shader, "u_layer");
+
+    // the layers never change, so they are uploaded once
+    float tile[BACKGROUND_LAYERS][3];
+    for (long i = 0; i < count; i++) {
+        tile[i][0] = layers[i].width;
+        tile[i][1] = layers[i].height;
+        tile[i][2] = layers[i].rate;
+    }
+
+    unsigned int shader = background->shader;
+    glstate_use_program(shader);
+    for (long i = 0; i < count; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "u_textures[%ld]", i);
+        glUniform1i(glGetUniformLocation(shader, name), i);
+        background->textures[i] = layers[i].texture;
+    }
+    glUniform3fv(glGetUniformLocation(shader, "u_tile"), count, (const float*)tile);
+    glUniform2f(glGetUniformLocation(shader, "u_view"), width / 2.0f, height / 2.0f);
+    glstate_use_program(0);
+
+    // core profile wants a vertex array bound even with no attributes
+    glGenVertexArrays(1, &background->vao);
+    return true;
+}
+
+void
+background_destroy(struct FlappyBackground* background)
+{
+    assert(background != NULL);
+
+    glstate_forget();
+    glDeleteProgram(background->shader);
+    glDeleteVertexArrays(1, &background->vao);
+}
+
+void
+background_draw(const struct FlappyBackground* background, float z)
+{
+    assert(background != NULL);
+
+    glstate_use_program(background->shader);
+    glUniform1f(background->uniform_layer, z);
+    glstate_bind_vertex_array(background->vao);
+    for (long i = 0; i < background->count; i++) {
+        glstate_bind_texture(i, background->textures[i]);
+    }
+    glDrawArrays(GL_TRIANGLES, 0, BACKGROUND_VERTICES);
+}
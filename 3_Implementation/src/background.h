@@ -0,0 +1,39 @@
+#ifndef FLAPPY_BACKGROUND_H_INCLUDED
+#define FLAPPY_BACKGROUND_H_INCLUDED
+
+#include <stdbool.h>
+
+// Scrolling background. All layers are drawn by one quad covering the
+// view. Each layer has its own texture, tiled across the view by the
+// GL_REPEAT wrap mode texture_create sets, and is scrolled by offsetting
+// its texture coordinates with the Frame block's u_scroll times the
+// layer's rate. Layers are composited in order and the first is opaque.
+// The shaders are built for the exact layer count given at creation.
+
+enum {
+    BACKGROUND_LAYERS = 4,  // must match background_frag.glsl
+};
+
+struct BackgroundLayer {
+    unsigned int texture;
+    float width;   // world size of one tile, centered on the origin
+    float height;
+    float rate;    // scroll speed relative to u_scroll, < 1.0 looks farther away
+};
+
+struct FlappyBackground {
+    unsigned int shader;
+    unsigned int vao;
+    int uniform_layer;
+    long count;
+    unsigned int textures[BACKGROUND_LAYERS];
+};
+
+// width and height are the visible world, layers are fixed from here on
+bool background_create(struct FlappyBackground* background, float width, float height,
+    const struct BackgroundLayer* layers, long count);
+void background_destroy(struct FlappyBackground* background);
+
+void background_draw(const struct FlappyBackground* background, float z);
+
+#endif
@@ -0,0 +1,396 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "batch.h"
+#include "config.h"
+#include "physics.h"
+#include "rng.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+// The SIMD kernels below mirror sim_step lane for lane. They use the same
+// single precision operations in the same order (no FMA), so a batch lane
+// and a FlappySim fed the same input and seed produce identical floats.
+
+static void
+batch_reset_lane(struct FlappyBatch* batch, long i, uint32_t seed)
+{
+    batch->seed[i] = seed;
+    batch->playing[i] = 0;
+    batch->game_over[i] = 0;
+    batch->space[i] = 0;
+    batch->score[i] = 0;
+
+    batch->camera[i] = -3.0f;
+    batch->bird_pos_x[i] = -6.0f;
+    batch->bird_pos_y[i] = 0.0f;
+    batch->bird_vel_x[i] = SPEED;
+    batch->bird_vel_y[i] = 0.0f;
+}
+
+static void
+batch_step_lane(struct FlappyBatch* batch, long i, bool flap, float dt)
+{
+    if (flap) {
+        if (batch->game_over[i]) batch_reset_lane(batch, i, batch->seed[i] + 1);
+
+        batch->playing[i] = 1;
+        if (!batch->space[i]) {
+            batch->bird_vel_y[i] = FLAP;
+            batch->space[i] = 1;
+        } else {
+            batch->bird_vel_y[i] -= dt * GRAVITY;
+        }
+    } else {
+        if (batch->playing[i]) {
+            batch->bird_vel_y[i] -= dt * GRAVITY;
+        }
+        batch->space[i] = 0;
+    }
+
+    if (batch->playing[i]) {
+        batch->bird_pos_x[i] += (batch->bird_vel_x[i] * dt);
+        batch->bird_pos_y[i] += (batch->bird_vel_y[i] * dt);
+        batch->camera[i] += (batch->bird_vel_x[i] * dt);
+    }
+
+    float x = batch->bird_pos_x[i];
+    float y = batch->bird_pos_y[i];
+    if (x >= -4.0f) {
+        long pipe_index = (x + 2.0f) / 4.0f;
+        float gap = sim_gap(batch->seed[i], pipe_index);
+
+        bool collision = false;
+        collision |= physics_intersect_circle_rect(x, y, 0.3f, pipe_index * 4.0f, gap + GAP, PIPE_WIDTH, PIPE_HEIGHT);
+        collision |= physics_intersect_circle_rect(x, y, 0.3f, pipe_index * 4.0f, gap - GAP, PIPE_WIDTH, PIPE_HEIGHT);
+        collision |= y > 4.5f || y < -4.5f;
+
+        if (collision && !batch->game_over[i]) {
+            batch->game_over[i] = 1;
+            batch->bird_vel_x[i] = 0.0f;
+            batch->bird_vel_y[i] = 8.0f;
+        }
+    }
+
+    batch->score[i] = (x + 3.0f) / 4.0f;
+}
+
+#ifdef BATCH_X86
+
+static inline __m128
+sse_select(__m128 a, __m128 b, __m128 mask)
+{
+    return _mm_or_ps(_mm_andnot_ps(mask, a), _mm_and_ps(mask, b));
+}
+
+// physics_intersect_circle_rect for 4 circles of radius 0.3 against pipes
+static inline __m128
+sse_intersect_pipe(__m128 cx, __m128 cy, __m128 rx, __m128 ry)
+{
+    const __m128 half_rw = _mm_set1_ps(PIPE_WIDTH / 2.0f);
+    const __m128 half_rh = _mm_set1_ps(PIPE_HEIGHT / 2.0f);
+
+    __m128 test_x = _mm_min_ps(_mm_max_ps(cx, _mm_sub_ps(rx, half_rw)), _mm_add_ps(rx, half_rw));
+    __m128 test_y = _mm_min_ps(_mm_max_ps(cy, _mm_sub_ps(ry, half_rh)), _mm_add_ps(ry, half_rh));
+    __m128 dist_x = _mm_sub_ps(cx, test_x);
+    __m128 dist_y = _mm_sub_ps(cy, test_y);
+    __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dist_x, dist_x), _mm_mul_ps(dist_y, dist_y)));
+    return _mm_cmple_ps(distance, _mm_set1_ps(0.3f));
+}
+
+static void
+batch_step_sse2(struct FlappyBatch* batch, const unsigned char* flap, float dt, long count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128 v_dt = _mm_set1_ps(dt);
+    const __m128 v_gdt = _mm_set1_ps(dt * GRAVITY);
+
+    for (long i = 0; i + 4 <= count; i += 4) {
+        int packed;
+        memcpy(&packed, flap + i, sizeof(packed));
+        __m128i f = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+        __m128 m_flap = _mm_castsi128_ps(_mm_cmpgt_epi32(f, zero));
+        __m128 m_play = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)(batch->playing + i)), zero));
+        __m128 m_over = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)(batch->game_over + i)), zero));
+        __m128 m_space = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)(batch->space + i)), zero));
+        __m128i seed = _mm_loadu_si128((const __m128i*)(batch->seed + i));
+
+        __m128 cam = _mm_loadu_ps(batch->camera + i);
+        __m128 x = _mm_loadu_ps(batch->bird_pos_x + i);
+        __m128 y = _mm_loadu_ps(batch->bird_pos_y + i);
+        __m128 vx = _mm_loadu_ps(batch->bird_vel_x + i);
+        __m128 vy = _mm_loadu_ps(batch->bird_vel_y + i);
+
+        // flapping after a game over restarts that bird
+        __m128 m_reset = _mm_and_ps(m_flap, m_over);
+        seed = _mm_add_epi32(seed, _mm_and_si128(_mm_castps_si128(m_reset), one));
+        cam = sse_select(cam, _mm_set1_ps(-3.0f), m_reset);
+        x = sse_select(x, _mm_set1_ps(-6.0f), m_reset);
+        y = sse_select(y, _mm_setzero_ps(), m_reset);
+        vx = sse_select(vx, _mm_set1_ps(SPEED), m_reset);
+        vy = sse_select(vy, _mm_setzero_ps(), m_reset);
+        m_play = _mm_andnot_ps(m_reset, m_play);
+        m_over = _mm_andnot_ps(m_reset, m_over);
+        m_space = _mm_andnot_ps(m_reset, m_space);
+
+        // only allow single flaps (not continuous)
+        __m128 m_kick = _mm_andnot_ps(m_space, m_flap);
+        __m128 m_fall = _mm_or_ps(_mm_and_ps(m_flap, m_space), _mm_andnot_ps(m_flap, m_play));
+        vy = sse_select(vy, _mm_sub_ps(vy, v_gdt), m_fall);
+        vy = sse_select(vy, _mm_set1_ps(FLAP), m_kick);
+        m_space = m_flap;
+        m_play = _mm_or_ps(m_play, m_flap);
+
+        // update bird and camera positions
+        x = sse_select(x, _mm_add_ps(x, _mm_mul_ps(vx, v_dt)), m_play);
+        y = sse_select(y, _mm_add_ps(y, _mm_mul_ps(vy, v_dt)), m_play);
+        cam = sse_select(cam, _mm_add_ps(cam, _mm_mul_ps(vx, v_dt)), m_play);
+
+        // generate the next approaching pipe (SSE2 has no 32-bit multiply)
+        __m128i pipe_index = _mm_cvttps_epi32(_mm_div_ps(_mm_add_ps(x, _mm_set1_ps(2.0f)), _mm_set1_ps(4.0f)));
+        int idx[4];
+        uint32_t seeds[4];
+        _mm_storeu_si128((__m128i*)idx, pipe_index);
+        _mm_storeu_si128((__m128i*)seeds, seed);
+        __m128 gap = _mm_setr_ps(sim_gap(seeds[0], idx[0]), sim_gap(seeds[1], idx[1]),
+            sim_gap(seeds[2], idx[2]), sim_gap(seeds[3], idx[3]));
+        __m128 pipe_x = _mm_mul_ps(_mm_cvtepi32_ps(pipe_index), _mm_set1_ps(4.0f));
+
+        // check collision
+        __m128 hit = sse_intersect_pipe(x, y, pipe_x, _mm_add_ps(gap, _mm_set1_ps(GAP)));
+        hit = _mm_or_ps(hit, sse_intersect_pipe(x, y, pipe_x, _mm_sub_ps(gap, _mm_set1_ps(GAP))));
+        hit = _mm_or_ps(hit, _mm_cmpgt_ps(y, _mm_set1_ps(4.5f)));
+        hit = _mm_or_ps(hit, _mm_cmplt_ps(y, _mm_set1_ps(-4.5f)));
+        hit = _mm_and_ps(hit, _mm_cmpge_ps(x, _mm_set1_ps(-4.0f)));
+        hit = _mm_andnot_ps(m_over, hit);
+        vx = sse_select(vx, _mm_setzero_ps(), hit);
+        vy = sse_select(vy, _mm_set1_ps(8.0f), hit);
+        m_over = _mm_or_ps(m_over, hit);
+
+        __m128i score = _mm_cvttps_epi32(_mm_div_ps(_mm_add_ps(x, _mm_set1_ps(3.0f)), _mm_set1_ps(4.0f)));
+
+        _mm_storeu_si128((__m128i*)(batch->seed + i), seed);
+        _mm_storeu_si128((__m128i*)(batch->playing + i), _mm_and_si128(_mm_castps_si128(m_play), one));
+        _mm_storeu_si128((__m128i*)(batch->game_over + i), _mm_and_si128(_mm_castps_si128(m_over), one));
+        _mm_storeu_si128((__m128i*)(batch->space + i), _mm_and_si128(_mm_castps_si128(m_space), one));
+        _mm_storeu_si128((__m128i*)(batch->score + i), score);
+        _mm_storeu_ps(batch->camera + i, cam);
+        _mm_storeu_ps(batch->bird_pos_x + i, x);
+        _mm_storeu_ps(batch->bird_pos_y + i, y);
+        _mm_storeu_ps(batch->bird_vel_x + i, vx);
+        _mm_storeu_ps(batch->bird_vel_y + i, vy);
+    }
+}
+
+#define BATCH_AVX2 __attribute__((target("avx2")))
+
+// rng_mix for 8 lanes
+static inline BATCH_AVX2 __m256i
+avx2_mix(__m256i x)
+{
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)RNG_MIX_1));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 15));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)RNG_MIX_2));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    return x;
+}
+
+// sim_gap for 8 lanes
+static inline BATCH_AVX2 __m256
+avx2_gap(__m256i seed, __m256i index)
+{
+    __m256i counter = _mm256_add_epi32(index, _mm256_set1_epi32(1));
+    __m256i hash = avx2_mix(_mm256_add_epi32(avx2_mix(seed), _mm256_mullo_epi32(counter, _mm256_set1_epi32((int)RNG_GAMMA))));
+    __m256 gap = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(hash, 8)), _mm256_set1_ps(1.0f / 16777216.0f));
+    gap = _mm256_sub_ps(gap, _mm256_set1_ps(0.5f));
+    return _mm256_mul_ps(gap, _mm256_set1_ps(4.0f));
+}
+
+static inline BATCH_AVX2 __m256
+avx2_intersect_pipe(__m256 cx, __m256 cy, __m256 rx, __m256 ry)
+{
+    const __m256 half_rw = _mm256_set1_ps(PIPE_WIDTH / 2.0f);
+    const __m256 half_rh = _mm256_set1_ps(PIPE_HEIGHT / 2.0f);
+
+    __m256 test_x = _mm256_min_ps(_mm256_max_ps(cx, _mm256_sub_ps(rx, half_rw)), _mm256_add_ps(rx, half_rw));
+    __m256 test_y = _mm256_min_ps(_mm256_max_ps(cy, _mm256_sub_ps(ry, half_rh)), _mm256_add_ps(ry, half_rh));
+    __m256 dist_x = _mm256_sub_ps(cx, test_x);
+    __m256 dist_y = _mm256_sub_ps(cy, test_y);
+    __m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dist_x, dist_x), _mm256_mul_ps(dist_y, dist_y)));
+    return _mm256_cmp_ps(distance, _mm256_set1_ps(0.3f), _CMP_LE_OQ);
+}
+
+static BATCH_AVX2 void
+batch_step_avx2(struct FlappyBatch* batch, const unsigned char* flap, float dt, long count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256 v_dt = _mm256_set1_ps(dt);
+    const __m256 v_gdt = _mm256_set1_ps(dt * GRAVITY);
+
+    for (long i = 0; i + 8 <= count; i += 8) {
+        __m256i f = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(flap + i)));
+        __m256 m_flap = _mm256_castsi256_ps(_mm256_cmpgt_epi32(f, zero));
+        __m256 m_play = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(batch->playing + i)), zero));
+        __m256 m_over = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(batch->game_over + i)), zero));
+        __m256 m_space = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(batch->space + i)), zero));
+        __m256i seed = _mm256_loadu_si256((const __m256i*)(batch->seed + i));
+
+        __m256 cam = _mm256_loadu_ps(batch->camera + i);
+        __m256 x = _mm256_loadu_ps(batch->bird_pos_x + i);
+        __m256 y = _mm256_loadu_ps(batch->bird_pos_y + i);
+        __m256 vx = _mm256_loadu_ps(batch->bird_vel_x + i);
+        __m256 vy = _mm256_loadu_ps(batch->bird_vel_y + i);
+
+        // flapping after a game over restarts that bird
+        __m256 m_reset = _mm256_and_ps(m_flap, m_over);
+        seed = _mm256_add_epi32(seed, _mm256_and_si256(_mm256_castps_si256(m_reset), one));
+        cam = _mm256_blendv_ps(cam, _mm256_set1_ps(-3.0f), m_reset);
+        x = _mm256_blendv_ps(x, _mm256_set1_ps(-6.0f), m_reset);
+        y = _mm256_blendv_ps(y, _mm256_setzero_ps(), m_reset);
+        vx = _mm256_blendv_ps(vx, _mm256_set1_ps(SPEED), m_reset);
+        vy = _mm256_blendv_ps(vy, _mm256_setzero_ps(), m_reset);
+        m_play = _mm256_andnot_ps(m_reset, m_play);
+        m_over = _mm256_andnot_ps(m_reset, m_over);
+        m_space = _mm256_andnot_ps(m_reset, m_space);
+
+        // only allow single flaps (not continuous)
+        __m256 m_kick = _mm256_andnot_ps(m_space, m_flap);
+        __m256 m_fall = _mm256_or_ps(_mm256_and_ps(m_flap, m_space), _mm256_andnot_ps(m_flap, m_play));
+        vy = _mm256_blendv_ps(vy, _mm256_sub_ps(vy, v_gdt), m_fall);
+        vy = _mm256_blendv_ps(vy, _mm256_set1_ps(FLAP), m_kick);
+        m_space = m_flap;
+        m_play = _mm256_or_ps(m_play, m_flap);
+
+        // update bird and camera positions
+        x = _mm256_blendv_ps(x, _mm256_add_ps(x, _mm256_mul_ps(vx, v_dt)), m_play);
+        y = _mm256_blendv_ps(y, _mm256_add_ps(y, _mm256_mul_ps(vy, v_dt)), m_play);
+        cam = _mm256_blendv_ps(cam, _mm256_add_ps(cam, _mm256_mul_ps(vx, v_dt)), m_play);
+
+        // generate the next approaching pipe for all 8 birds at once
+        __m256i pipe_index = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_add_ps(x, _mm256_set1_ps(2.0f)), _mm256_set1_ps(4.0f)));
+        __m256 gap = avx2_gap(seed, pipe_index);
+        __m256 pipe_x = _mm256_mul_ps(_mm256_cvtepi32_ps(pipe_index), _mm256_set1_ps(4.0f));
+
+        // check collision
+        __m256 hit = avx2_intersect_pipe(x, y, pipe_x, _mm256_add_ps(gap, _mm256_set1_ps(GAP)));
+        hit = _mm256_or_ps(hit, avx2_intersect_pipe(x, y, pipe_x, _mm256_sub_ps(gap, _mm256_set1_ps(GAP))));
+        hit = _mm256_or_ps(hit, _mm256_cmp_ps(y, _mm256_set1_ps(4.5f), _CMP_GT_OQ));
+        hit = _mm256_or_ps(hit, _mm256_cmp_ps(y, _mm256_set1_ps(-4.5f), _CMP_LT_OQ));
+        hit = _mm256_and_ps(hit, _mm256_cmp_ps(x, _mm256_set1_ps(-4.0f), _CMP_GE_OQ));
+        hit = _mm256_andnot_ps(m_over, hit);
+        vx = _mm256_blendv_ps(vx, _mm256_setzero_ps(), hit);
+        vy = _mm256_blendv_ps(vy, _mm256_set1_ps(8.0f), hit);
+        m_over = _mm256_or_ps(m_over, hit);
+
+        __m256i score = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_add_ps(x, _mm256_set1_ps(3.0f)), _mm256_set1_ps(4.0f)));
+
+        _mm256_storeu_si256((__m256i*)(batch->seed + i), seed);
+        _mm256_storeu_si256((__m256i*)(batch->playing + i), _mm256_and_si256(_mm256_castps_si256(m_play), one));
+        _mm256_storeu_si256((__m256i*)(batch->game_over + i), _mm256_and_si256(_mm256_castps_si256(m_over), one));
+        _mm256_storeu_si256((__m256i*)(batch->space + i), _mm256_and_si256(_mm256_castps_si256(m_space), one));
+        _mm256_storeu_si256((__m256i*)(batch->score + i), score);
+        _mm256_storeu_ps(batch->camera + i, cam);
+        _mm256_storeu_ps(batch->bird_pos_x + i, x);
+        _mm256_storeu_ps(batch->bird_pos_y + i, y);
+        _mm256_storeu_ps(batch->bird_vel_x + i, vx);
+        _mm256_storeu_ps(batch->bird_vel_y + i, vy);
+    }
+}
+
+#endif
+
+bool
+batch_create(struct FlappyBatch* batch, long count)
+{
+    assert(batch != NULL);
+    assert(count > 0);
+
+    memset(batch, 0, sizeof(*batch));
+    batch->count = count;
+    batch->capacity = (count + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES;
+
+    batch->seed = calloc(batch->capacity, sizeof(uint32_t));
+    batch->playing = calloc(batch->capacity, sizeof(int));
+    batch->game_over = calloc(batch->capacity, sizeof(int));
+    batch->space = calloc(batch->capacity, sizeof(int));
+    batch->score = calloc(batch->capacity, sizeof(int));
+    batch->camera = calloc(batch->capacity, sizeof(float));
+    batch->bird_pos_x = calloc(batch->capacity, sizeof(float));
+    batch->bird_pos_y = calloc(batch->capacity, sizeof(float));
+    batch->bird_vel_x = calloc(batch->capacity, sizeof(float));
+    batch->bird_vel_y = calloc(batch->capacity, sizeof(float));
+
+    if (batch->seed == NULL || batch->playing == NULL || batch->game_over == NULL || batch->space == NULL ||
+        batch->score == NULL || batch->camera == NULL || batch->bird_pos_x == NULL ||
+        batch->bird_pos_y == NULL || batch->bird_vel_x == NULL || batch->bird_vel_y == NULL) {
+        fprintf(stderr, "failed to allocate batch of %ld birds\n", count);
+        batch_destroy(batch);
+        return false;
+    }
+
+    batch_reset(batch, 0);
+    return true;
+}
+
+void
+batch_destroy(struct FlappyBatch* batch)
+{
+    assert(batch != NULL);
+
+    free(batch->seed);
+    free(batch->playing);
+    free(batch->game_over);
+    free(batch->space);
+    free(batch->score);
+    free(batch->camera);
+    free(batch->bird_pos_x);
+    free(batch->bird_pos_y);
+    free(batch->bird_vel_x);
+    free(batch->bird_vel_y);
+    memset(batch, 0, sizeof(*batch));
+}
+
+void
+batch_reset(struct FlappyBatch* batch, uint32_t seed)
+{
+    assert(batch != NULL);
+
+    for (long i = 0; i < batch->capacity; i++) {
+        batch_reset_lane(batch, i, seed);
+    }
+}
+
+void
+batch_step(struct FlappyBatch* batch, const unsigned char* flap, double delta)
+{
+    assert(batch != NULL);
+    assert(flap != NULL);
+
+    float dt = (float)delta;
+    long done = 0;
+
+#ifdef BATCH_X86
+    if (__builtin_cpu_supports("avx2")) {
+        done = batch->count / 8 * 8;
+        batch_step_avx2(batch, flap, dt, done);
+    } else {
+        done = batch->count / 4 * 4;
+        batch_step_sse2(batch, flap, dt, done);
+    }
+#endif
+
+    // leftover birds that don't fill a whole vector
+    for (long i = done; i < batch->count; i++) {
+        batch_step_lane(batch, i, flap[i] != 0, dt);
+    }
+}
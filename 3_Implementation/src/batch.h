@@ -0,0 +1,48 @@
+#ifndef FLAPPY_BATCH_H_INCLUDED
+#define FLAPPY_BATCH_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sim.h"
+
+// Many independent birds stepped together. The per-bird state is stored
+// as structure-of-arrays so batch_step can run 8 birds per instruction
+// (AVX2) or 4 (SSE2), falling back to scalar code elsewhere. Each bird
+// has its own level seed, so birds can fly the same or different levels.
+//
+// Flags are stored as 0 / 1 ints to keep them the same width as the floats.
+
+enum {
+    BATCH_LANES = 8,  // arrays are padded to a multiple of this
+};
+
+struct FlappyBatch {
+    long count;
+    long capacity;
+
+    // game state
+    uint32_t* seed;
+    int* playing;
+    int* game_over;
+    int* space;
+    int* score;
+
+    // game objects
+    float* camera;
+    float* bird_pos_x;
+    float* bird_pos_y;
+    float* bird_vel_x;
+    float* bird_vel_y;
+};
+
+bool batch_create(struct FlappyBatch* batch, long count);
+void batch_destroy(struct FlappyBatch* batch);
+
+// every bird starts on the level of the same seed
+void batch_reset(struct FlappyBatch* batch, uint32_t seed);
+
+// flap holds one entry per bird (non-zero while the flap key is held)
+void batch_step(struct FlappyBatch* batch, const unsigned char* flap, double delta);
+
+#endif
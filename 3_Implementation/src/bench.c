@@ -0,0 +1,334 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "batch.h"
+#include "config.h"
+#include "font.h"
+#include "glnull.h"
+#include "glstate.h"
+#include "headless.h"
+#include "opengl.h"
+#include "physics.h"
+#include "play.h"
+#include "pool.h"
+#include "sim.h"
+#include "texture.h"
+
+// Benchmarks print one JSON document to stdout:
+//
+//   { "benchmarks": [
+//     { "name": "sim_step", "ops": 8192000, "seconds": 0.23, "ns_per_op": 28.1, "ops_per_sec": 35587188 },
+//     ...
+//   ] }
+//
+// Names and their order are fixed so runs can be diffed between releases.
+// Nothing needs a display: the GL paths run on an offscreen EGL context
+// (see headless.h) and game_render_null on the null GL backend.
+
+enum {
+    BENCH_WIDTH = 1280,  // offscreen framebuffer for the GL paths
+    BENCH_HEIGHT = 720,
+    BENCH_BIRDS = 4096,
+    BENCH_STEPS = 2000,
+    BENCH_PATTERN = 64,
+};
+
+// deterministic flap pattern so both paths do the same work (every bird
+// also starts from seed 0 in both, batch_create's seed)
+static unsigned char flaps[BENCH_PATTERN][BENCH_BIRDS];
+
+// results are summed in here so the compiler can't drop the calls
+static volatile long sink;
+
+static long reported;
+
+static double
+bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+bench_report(const char* name, double ops, double seconds)
+{
+    printf("%s\n    { \"name\": \"%s\", \"ops\": %.0f, \"seconds\": %.6f, \"ns_per_op\": %.3f, \"ops_per_sec\": %.0f }",
+        reported++ ? "," : "", name, ops, seconds,
+        ops > 0.0 ? seconds / ops * 1e9 : 0.0,
+        seconds > 0.0 ? ops / seconds : 0.0);
+}
+
+static void
+bench_flaps_init(void)
+{
+    for (long s = 0; s < BENCH_PATTERN; s++) {
+        for (long b = 0; b < BENCH_BIRDS; b++) {
+            flaps[s][b] = (s % (20 + b % 17)) < 2;
+        }
+    }
+}
+
+static void
+bench_sim_scalar(void)
+{
+    static struct FlappySim games[BENCH_BIRDS];
+    for (long b = 0; b < BENCH_BIRDS; b++) {
+        sim_reset(&games[b], 0);
+    }
+
+    double start = bench_now();
+    for (long s = 0; s < BENCH_STEPS; s++) {
+        for (long b = 0; b < BENCH_BIRDS; b++) {
+            struct FlappyInput input = { .flap = flaps[s % BENCH_PATTERN][b] };
+            sim_step(&games[b], &input, 1.0 / STEP_RATE);
+        }
+    }
+    bench_report("sim_step", (double)BENCH_BIRDS * BENCH_STEPS, bench_now() - start);
+}
+
+static void
+bench_sim_batch(void)
+{
+    struct FlappyBatch batch;
+    if (!batch_create(&batch, BENCH_BIRDS)) {
+        return;
+    }
+
+    double start = bench_now();
+    for (long s = 0; s < BENCH_STEPS; s++) {
+        batch_step(&batch, flaps[s % BENCH_PATTERN], 1.0 / STEP_RATE);
+    }
+    bench_report("batch_step", (double)BENCH_BIRDS * BENCH_STEPS, bench_now() - start);
+
+    batch_destroy(&batch);
+}
+
+static void
+bench_snapshot(void)
+{
+    enum { PAIRS = 20000000 };
+
+    struct FlappySim game;
+    sim_reset(&game, 1);
+    struct FlappySnapshot snap;
+
+    double start = bench_now();
+    for (long i = 0; i < PAIRS; i++) {
+        flappy_snapshot(&game, &snap);
+        snap.bird_pos_y += 1e-6f;
+        flappy_restore(&game, &snap);
+    }
+    bench_report("snapshot_restore", PAIRS, bench_now() - start);
+}
+
+static void
+bench_pool(long threads)
+{
+    struct FlappyPool* pool = pool_create(BENCH_BIRDS, threads, 4);
+    if (pool == NULL) {
+        return;
+    }
+
+    static float obs[BENCH_BIRDS * POOL_OBS];
+    static float reward[BENCH_BIRDS];
+    static unsigned char done[BENCH_BIRDS];
+    static long ids[BENCH_BIRDS];
+
+    for (long s = 0; s < BENCH_STEPS / 4; s++) {
+        pool_step(pool, flaps[s % BENCH_PATTERN], obs, reward, done);
+
+        // keep the pool busy by restarting finished games every so often
+        if (s % 64 == 63) {
+            long count = 0;
+            for (long b = 0; b < BENCH_BIRDS; b++) {
+                if (done[b]) ids[count++] = b;
+            }
+            pool_reset(pool, ids, count, obs);
+        }
+    }
+
+    struct FlappyPoolStats stats;
+    pool_stats(pool, &stats);
+
+    char name[32];
+    snprintf(name, sizeof(name), "pool_step_x%ld", threads);
+    bench_report(name, stats.steps, stats.seconds);
+
+    pool_destroy(pool);
+}
+
+static void
+bench_physics(void)
+{
+    enum { CALLS = 20000000, POINTS = 256 };
+
+    // a spread of birds around one pipe, about half of them touching it
+    float xs[POINTS];
+    float ys[POINTS];
+    for (long i = 0; i < POINTS; i++) {
+        xs[i] = (i % 16) * 0.125f - 1.0f;
+        ys[i] = (i / 16) * 0.5f - 4.0f;
+    }
+
+    long hits = 0;
+    double start = bench_now();
+    for (long i = 0; i < CALLS; i++) {
+        long p = i % POINTS;
+        hits += physics_intersect_circle_rect(xs[p], ys[p], 0.3f, 0.0f, 0.0f, PIPE_WIDTH, PIPE_HEIGHT);
+    }
+    bench_report("physics_intersect_circle_rect", CALLS, bench_now() - start);
+    sink += hits;
+}
+
+static void
+bench_font(void)
+{
+    enum { CALLS = 2000000 };
+
+    // what the score counter shows over a typical run
+    static const char* scores[] = { "000", "007", "042", "123", "999", "1000" };
+    enum { SCORES = sizeof(scores) / sizeof(scores[0]) };
+
+    float buffer[4096];
+    long total = 0;
+
+    double start = bench_now();
+    for (long i = 0; i < CALLS; i++) {
+        total += font_size(scores[i % SCORES]);
+    }
+    bench_report("font_size", CALLS, bench_now() - start);
+
+    start = bench_now();
+    for (long i = 0; i < CALLS; i++) {
+        total += font_vertices(scores[i % SCORES]);
+    }
+    bench_report("font_vertices", CALLS, bench_now() - start);
+
+    start = bench_now();
+    for (long i = 0; i < CALLS; i++) {
+        font_print(scores[i % SCORES], buffer, sizeof(buffer));
+        total += buffer[0];
+    }
+    bench_report("font_print", CALLS, bench_now() - start);
+
+    start = bench_now();
+    for (long i = 0; i < CALLS; i++) {
+        font_glyph_print(scores[i % SCORES], buffer, sizeof(buffer));
+        total += buffer[0];
+    }
+    bench_report("font_glyph_print", CALLS, bench_now() - start);
+
+    sink += total;
+}
+
+// game_render against the null backend: only the CPU side (matrices,
+// labels, sprite sorting, state shadowing), no driver at all
+static void
+bench_gl_null(void)
+{
+    enum { FRAMES = 20000 };
+
+    struct FlappyGLNull gl;
+    if (!glnull_load(&gl, 0)) return;
+    glstate_forget();
+
+    struct FlappyBoard game = { 0 };
+    if (!start_game(&game, 1)) {
+        glnull_unload(&gl);
+        return;
+    }
+    game.step = 1.0 / STEP_RATE;
+
+    double start = bench_now();
+    for (long i = 0; i < FRAMES; i++) {
+        game_render(&game, 1280, 720, i / 60.0);
+    }
+    bench_report("game_render_null", FRAMES, bench_now() - start);
+
+    end_game(&game);
+    glnull_unload(&gl);
+}
+
+static bool
+bench_gl(void)
+{
+    enum { STEPS = 1000000, UPLOADS = 200, FRAMES = 500 };
+
+    struct FlappyHeadless headless;
+    if (!headless_create(&headless, BENCH_WIDTH, BENCH_HEIGHT, true, false)) {
+        return false;
+    }
+
+    glstate_forget();
+    glstate_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glstate_depth_func(GL_LEQUAL);
+
+    struct FlappyBoard game = { 0 };
+    if (!start_game(&game, 1)) {
+        headless_destroy(&headless);
+        return false;
+    }
+    game.step = 1.0 / STEP_RATE;
+
+    // one whole fixed step per call, with the key up (change_gme only
+    // samples the window's keys and hands them to input_gme)
+    struct FlappyInput input = { .flap = false };
+    double start = bench_now();
+    for (long i = 0; i < STEPS; i++) {
+        input_gme(&game, &input, game.step);
+    }
+    bench_report("input_gme", STEPS, bench_now() - start);
+
+    // glFinish so the upload itself is timed, not just queued
+    start = bench_now();
+    for (long i = 0; i < UPLOADS; i++) {
+        unsigned int tex = texture_create(TEXTURE_SPRITES_FORMAT, TEXTURE_SPRITES_WIDTH, TEXTURE_SPRITES_HEIGHT, TEXTURE_SPRITES_PIXELS);
+        glDeleteTextures(1, &tex);
+    }
+    glFinish();
+    bench_report("texture_create", UPLOADS, bench_now() - start);
+
+    rst_gme(&game, 1);
+    start = bench_now();
+    for (long i = 0; i < FRAMES; i++) {
+        game_render(&game, BENCH_WIDTH, BENCH_HEIGHT, i / 60.0);
+    }
+    glFinish();
+    bench_report("game_render", FRAMES, bench_now() - start);
+
+    end_game(&game);
+    headless_destroy(&headless);
+    return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+    // pool sizes are fixed too, whatever the machine has
+    static const long threads[] = { 1, 2, 4, 8 };
+
+    printf("{ \"benchmarks\": [");
+
+    bench_flaps_init();
+
+    bench_sim_scalar();
+    bench_sim_batch();
+    bench_snapshot();
+    for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+        bench_pool(threads[i]);
+    }
+
+    bench_physics();
+    bench_font();
+    bool ok = bench_gl();
+    bench_gl_null();
+
+    printf("\n] }\n");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
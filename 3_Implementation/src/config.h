@@ -11,6 +11,9 @@ static const float SPEED   = 6.0f;
 static const float SCROLL  = 1.0f;
 static const float GRAVITY = 18.0f;
 
+static const float STEP_RATE  = 120.0f;  // fixed simulation steps per second
+static const float STEP_LIMIT = 0.25f;   // max frame time fed to the simulation
+
 static const float BG_WIDTH    = 4.5;
 static const float BG_HEIGHT   = 9.0f;
 static const float BG_LAYER    = 0.0f;
@@ -20,5 +23,6 @@ static const float BIRD_LAYER  = 0.2f;
 static const float PIPE_WIDTH  = 1.0f;
 static const float PIPE_HEIGHT = 8.0f;
 static const float PIPE_LAYER  = 0.1f;
+static const float SCORE_LAYER = 0.5f;
 
 #endif
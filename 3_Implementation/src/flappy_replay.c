@@ -0,0 +1,98 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "replay.h"
+
+static void
+print_usage(const char* arg0)
+{
+    printf("usage: %s FILE...\n", arg0);
+    printf("\n");
+    printf("Re-simulates every run in the given replay logs as fast as\n");
+    printf("possible and checks that each one reproduces its recorded score.\n");
+}
+
+static unsigned char*
+read_file(const char* path, long* size)
+{
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "failed to open replay file: %s\n", path);
+        return NULL;
+    }
+
+    unsigned char* data = NULL;
+    long capacity = 0;
+    *size = 0;
+    for (;;) {
+        if (*size == capacity) {
+            capacity = capacity ? capacity * 2 : 4096;
+            unsigned char* grown = realloc(data, capacity);
+            if (grown == NULL) {
+                fprintf(stderr, "failed to read replay file: %s\n", path);
+                free(data);
+                fclose(f);
+                return NULL;
+            }
+            data = grown;
+        }
+
+        size_t got = fread(data + *size, 1, capacity - *size, f);
+        if (got == 0) break;
+        *size += got;
+    }
+
+    fclose(f);
+    return data;
+}
+
+static double
+now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main(int argc, char* argv[])
+{
+    if (argc < 2 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0) {
+        print_usage(argv[0]);
+        return argc < 2 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    bool ok = true;
+    for (int i = 1; i < argc; i++) {
+        long size = 0;
+        unsigned char* data = read_file(argv[i], &size);
+        if (data == NULL) {
+            ok = false;
+            continue;
+        }
+
+        struct FlappyReplayStats stats;
+        double start = now();
+        bool valid = replay_play(data, size, &stats);
+        double elapsed = now() - start;
+        free(data);
+
+        if (!valid) {
+            fprintf(stderr, "%s: invalid replay\n", argv[i]);
+            ok = false;
+            continue;
+        }
+
+        printf("%s: %ld runs, %ld frames, %ld bytes, %ld mismatches, %.0f frames/sec\n",
+            argv[i], stats.runs, stats.frames, size, stats.mismatches,
+            elapsed > 0.0 ? stats.frames / elapsed : 0.0);
+        if (stats.mismatches > 0) ok = false;
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
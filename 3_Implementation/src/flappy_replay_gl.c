@@ -0,0 +1,192 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gltrace.h"
+#include "headless.h"
+#include "opengl.h"
+#include "timing.h"
+
+static void
+print_usage(const char* arg0)
+{
+    printf("usage: %s [options] TRACE\n", arg0);
+    printf("\n");
+    printf("Replays a GL trace written by flappy --trace as fast as possible on an\n");
+    printf("offscreen context and reports the frame times.\n");
+    printf("\n");
+    printf("Options:\n");
+    printf("  -h --help         print this help\n");
+    printf("  --loops N         replay the traced frames N times (default 1)\n");
+    printf("  --snapshot FILE   write the last frame to FILE (binary PPM)\n");
+    printf("  --golden FILE     fail unless the last frame matches FILE\n");
+    printf("  --timing FILE     dump per-frame times to FILE (.json or CSV)\n");
+}
+
+static unsigned char*
+read_file(const char* path, long* size)
+{
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "failed to open trace file: %s\n", path);
+        return NULL;
+    }
+
+    unsigned char* data = NULL;
+    long capacity = 0;
+    *size = 0;
+    for (;;) {
+        if (*size == capacity) {
+            capacity = capacity ? capacity * 2 : 1 << 20;
+            unsigned char* grown = realloc(data, capacity);
+            if (grown == NULL) {
+                fprintf(stderr, "failed to read trace file: %s\n", path);
+                free(data);
+                fclose(f);
+                return NULL;
+            }
+            data = grown;
+        }
+
+        size_t got = fread(data + *size, 1, capacity - *size, f);
+        if (got == 0) break;
+        *size += got;
+    }
+
+    fclose(f);
+    return data;
+}
+
+static double
+now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// check or keep the last frame
+static bool
+save_frame(const struct FlappyHeadless* headless, const char* snapshot_path, const char* golden_path)
+{
+    unsigned char* rgb = malloc(headless->width * headless->height * 3);
+    if (rgb == NULL) {
+        fprintf(stderr, "failed to allocate frame readback\n");
+        return false;
+    }
+
+    bool ok = true;
+    headless_read(headless, rgb);
+    if (snapshot_path != NULL) {
+        ok = headless_write_ppm(snapshot_path, rgb, headless->width, headless->height) && ok;
+    }
+    if (golden_path != NULL) {
+        ok = headless_match_ppm(golden_path, rgb, headless->width, headless->height) && ok;
+    }
+    free(rgb);
+    return ok;
+}
+
+int
+main(int argc, char* argv[])
+{
+    const char* trace_path = NULL;
+    const char* snapshot_path = NULL;
+    const char* golden_path = NULL;
+    const char* timing_path = NULL;
+    long loops = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        } else if (strcmp(argv[i], "--loops") == 0 && i + 1 < argc) {
+            loops = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc) {
+            snapshot_path = argv[++i];
+        } else if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc) {
+            golden_path = argv[++i];
+        } else if (strcmp(argv[i], "--timing") == 0 && i + 1 < argc) {
+            timing_path = argv[++i];
+        } else {
+            trace_path = argv[i];
+        }
+    }
+    if (trace_path == NULL || loops <= 0) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    long size = 0;
+    unsigned char* data = read_file(trace_path, &size);
+    if (data == NULL) return EXIT_FAILURE;
+
+    // the header says how big a context to make, so read it first
+    struct FlappyGLReplay replay;
+    if (!gltrace_replay_open(&replay, data, size, 0)) {
+        fprintf(stderr, "%s: invalid trace\n", trace_path);
+        free(data);
+        return EXIT_FAILURE;
+    }
+
+    struct FlappyHeadless headless;
+    if (!headless_create(&headless, replay.width, replay.height, replay.depth, false)) {
+        gltrace_replay_close(&replay);
+        free(data);
+        return EXIT_FAILURE;
+    }
+    replay.default_framebuffer = headless.framebuffer;
+
+    printf("OpenGL Renderer: %s\n", glGetString(GL_RENDERER));
+    printf("OpenGL Version:  %s\n", glGetString(GL_VERSION));
+
+    bool ok = gltrace_replay_setup(&replay);
+    glFinish();
+
+    // per-frame times (too big for the stack)
+    static struct FlappyTiming timing;
+    timing_init(&timing, now());
+
+    long frames = 0;
+    double start = now();
+    for (long loop = 0; ok && loop < loops; loop++) {
+        gltrace_replay_rewind(&replay);
+        for (long frame = 0; frame < replay.frames; frame++) {
+            if (!gltrace_replay_frame(&replay)) break;
+
+            // wait for each frame, so the time is the driver's and not just queueing
+            glFinish();
+            timing_mark(&timing, TIMING_RENDER, now());
+            timing_end_frame(&timing);
+            frames++;
+        }
+        if (replay.failed) ok = false;
+    }
+    double seconds = now() - start;
+
+    if (ok) {
+        struct FlappyTimingReport report;
+        timing_report(&timing, TIMING_TOTAL, frames, &report);
+        printf("%s: %ld frames at %ldx%ld, %ld bytes, %.3f s, %.1f fps\n",
+            trace_path, frames, replay.width, replay.height, size, seconds,
+            seconds > 0.0 ? frames / seconds : 0.0);
+        printf("frame ms: p50 %.3f  p90 %.3f  p99 %.3f  p99.9 %.3f  max %.3f\n",
+            report.p50, report.p90, report.p99, report.p999, report.max);
+
+        ok = save_frame(&headless, snapshot_path, golden_path);
+        if (timing_path != NULL) {
+            ok = timing_dump(&timing, timing_path) && ok;
+        }
+    } else {
+        fprintf(stderr, "%s: replay failed\n", trace_path);
+    }
+
+    gltrace_replay_close(&replay);
+    headless_destroy(&headless);
+    free(data);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
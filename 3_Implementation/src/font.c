@@ -181,3 +181,44 @@ font_print(const char* str, float* buffer, long size)
         x += 1;
     }
 }
+
+long
+font_glyphs(const char* str)
+{
+    assert(str != NULL);
+    long glyphs = 0;
+
+    char c;
+    while ((c = *str++) != '\0') {
+        c = c - '0';
+        assert(c >= 0 && c <= 9);
+
+        glyphs++;
+    }
+
+    return glyphs;
+}
+
+void
+font_glyph_print(const char* str, float* buffer, long size)
+{
+    assert(str != NULL);
+    assert(buffer != NULL);
+    assert(size >= font_glyphs(str) * FONT_GLYPH_FLOATS * (long)sizeof(float));
+
+    long x = 0;
+    long y = 0;
+
+    char c;
+    while ((c = *str++) != '\0') {
+        c = c - '0';
+        assert(c >= 0 && c <= 9);
+
+        // every 16-bit mask is exact in a float
+        *buffer++ = x;
+        *buffer++ = y;
+        *buffer++ = font[(unsigned char)c];
+
+        x += 1;
+    }
+}
@@ -1,8 +1,17 @@
 #ifndef FLAPPY_FONT_H_INCLUDED
 #define FLAPPY_FONT_H_INCLUDED
 
+enum {
+    FONT_GLYPH_FLOATS = 3,  // x, y and the 16-bit glyph mask per character
+};
+
+// triangles for every lit pixel, expanded on the CPU
 long font_size(const char* str);
 long font_vertices(const char* str);
 void font_print(const char* str, float* buffer, long size);
 
+// one instance per character, the font shader expands the pixels
+long font_glyphs(const char* str);
+void font_glyph_print(const char* str, float* buffer, long size);
+
 #endif
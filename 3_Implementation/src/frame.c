@@ -0,0 +1,41 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "frame.h"
+#include "glstate.h"
+#include "opengl.h"
+
+unsigned int
+frame_buffer_create(void)
+{
+    unsigned int ubo;
+    glGenBuffers(1, &ubo);
+    glstate_bind_buffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(struct FrameUniforms), NULL, GL_DYNAMIC_DRAW);
+
+    // the binding point is context state, so this only has to happen once
+    // (it also binds the generic target, which already holds ubo)
+    glBindBufferBase(GL_UNIFORM_BUFFER, FRAME_UNIFORM_BINDING, ubo);
+    return ubo;
+}
+
+void
+frame_buffer_update(unsigned int buffer, const struct FrameUniforms* frame)
+{
+    assert(frame != NULL);
+
+    glstate_bind_buffer(GL_UNIFORM_BUFFER, buffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(*frame), frame);
+}
+
+void
+frame_program_bind(unsigned int program)
+{
+    unsigned int block = glGetUniformBlockIndex(program, "Frame");
+    if (block == GL_INVALID_INDEX) {
+        fprintf(stderr, "program %u has no Frame uniform block\n", program);
+        return;
+    }
+    glUniformBlockBinding(program, block, FRAME_UNIFORM_BINDING);
+}
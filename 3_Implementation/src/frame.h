@@ -0,0 +1,30 @@
+#ifndef FLAPPY_FRAME_H_INCLUDED
+#define FLAPPY_FRAME_H_INCLUDED
+
+// Per-frame uniforms shared by every program through one uniform buffer.
+// Shaders declare the matching std140 block:
+//
+//   layout(std140) uniform Frame {
+//       mat4 u_projection;
+//       float u_time;
+//       float u_scroll;
+//   };
+
+enum {
+    FRAME_UNIFORM_BINDING = 0,
+};
+
+struct FrameUniforms {
+    float projection[16];
+    float time;    // seconds
+    float scroll;  // background scroll distance, unwrapped
+    float pad[2];  // std140 rounds the block up to a vec4
+};
+
+unsigned int frame_buffer_create(void);
+void frame_buffer_update(unsigned int buffer, const struct FrameUniforms* frame);
+
+// point a program's Frame block at the shared binding
+void frame_program_bind(unsigned int program);
+
+#endif
@@ -0,0 +1,131 @@
+#include <assert.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gldebug.h"
+#include "opengl.h"
+
+static const char* const GLDEBUG_NAMES[GLDEBUG_KINDS] = {
+    "implicit sync",
+    "shader recompile",
+    "reallocation",
+    "other performance",
+    "error",
+    "other",
+};
+
+// lowercase substrings that identify a performance warning, checked in
+// kind order so "recompiled ... to avoid a stall" counts as a recompile
+static const char* const GLDEBUG_RECOMPILE_WORDS[] = { "recompil", "compiling", "variant", NULL };
+static const char* const GLDEBUG_REALLOC_WORDS[] = { "realloc", "orphan", "respecif", "storage", NULL };
+static const char* const GLDEBUG_SYNC_WORDS[] = { "stall", "sync", "wait", "busy", "flush", NULL };
+
+static bool
+gldebug_mentions(const char* message, const char* const* words)
+{
+    for (long i = 0; words[i] != NULL; i++) {
+        if (strstr(message, words[i]) != NULL) return true;
+    }
+    return false;
+}
+
+enum gldebug_kind
+gldebug_classify(unsigned int type, const char* message)
+{
+    assert(message != NULL);
+
+    if (type == GL_DEBUG_TYPE_ERROR) return GLDEBUG_ERROR;
+    if (type != GL_DEBUG_TYPE_PERFORMANCE) return GLDEBUG_OTHER;
+
+    char lower[GLDEBUG_MESSAGE];
+    long length = 0;
+    for (; message[length] != '\0' && length < GLDEBUG_MESSAGE - 1; length++) {
+        lower[length] = tolower((unsigned char)message[length]);
+    }
+    lower[length] = '\0';
+
+    if (gldebug_mentions(lower, GLDEBUG_RECOMPILE_WORDS)) return GLDEBUG_RECOMPILE;
+    if (gldebug_mentions(lower, GLDEBUG_REALLOC_WORDS)) return GLDEBUG_REALLOC;
+    if (gldebug_mentions(lower, GLDEBUG_SYNC_WORDS)) return GLDEBUG_SYNC;
+    return GLDEBUG_PERFORMANCE;
+}
+
+static void APIENTRY
+gldebug_callback(GLenum source, GLenum type, GLuint id, GLenum severity,
+    GLsizei length, const GLchar* message, const void* user)
+{
+    struct FlappyGLDebug* debug = (struct FlappyGLDebug*)user;
+
+    enum gldebug_kind kind = gldebug_classify(type, message);
+    if (debug->frame[kind] == 0 && debug->total[kind] == 0) {
+        snprintf(debug->example[kind], GLDEBUG_MESSAGE, "%s", message);
+    }
+    debug->frame[kind]++;
+
+    if (kind == GLDEBUG_ERROR) {
+        fprintf(stderr, "GL error %u: %s\n", id, message);
+    }
+}
+
+bool
+gldebug_install(struct FlappyGLDebug* debug)
+{
+    assert(debug != NULL);
+
+    memset(debug, 0, sizeof(*debug));
+    if (!opengl_has_debug()) {
+        fprintf(stderr, "KHR_debug is not available, no driver messages\n");
+        return false;
+    }
+
+    // synchronous delivery runs the callback inside the offending call
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+    glDebugMessageCallback(gldebug_callback, debug);
+    return true;
+}
+
+void
+gldebug_remove(struct FlappyGLDebug* debug)
+{
+    assert(debug != NULL);
+
+    glDebugMessageCallback(NULL, NULL);
+    glDisable(GL_DEBUG_OUTPUT);
+}
+
+void
+gldebug_end_frame(struct FlappyGLDebug* debug)
+{
+    assert(debug != NULL);
+
+    for (long kind = 0; kind < GLDEBUG_KINDS; kind++) {
+        long count = debug->frame[kind];
+        if (count == 0) continue;
+
+        debug->total[kind] += count;
+        debug->frames[kind]++;
+        if (count > debug->worst[kind]) debug->worst[kind] = count;
+        debug->frame[kind] = 0;
+    }
+}
+
+void
+gldebug_print(struct FlappyGLDebug* debug, FILE* fp)
+{
+    assert(debug != NULL);
+    assert(fp != NULL);
+
+    for (long kind = 0; kind < GLDEBUG_KINDS; kind++) {
+        if (debug->total[kind] == 0) continue;
+
+        fprintf(fp, "GL %s: %ld messages in %ld frames (at most %ld in one), e.g. \"%s\"\n",
+            GLDEBUG_NAMES[kind], debug->total[kind], debug->frames[kind], debug->worst[kind], debug->example[kind]);
+        debug->total[kind] = 0;
+        debug->frames[kind] = 0;
+        debug->worst[kind] = 0;
+    }
+}
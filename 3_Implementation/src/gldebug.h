@@ -0,0 +1,50 @@
+#ifndef FLAPPY_GLDEBUG_H_INCLUDED
+#define FLAPPY_GLDEBUG_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// Driver messages from KHR_debug, counted per frame instead of lost.
+// Performance warnings are split by what the driver says it did (waited
+// on the GPU, recompiled a shader for new state, reallocated a buffer),
+// going by the wording Mesa and the desktop drivers use. Errors are also
+// printed as they arrive.
+//
+// Messages are delivered synchronously, so they count against the frame
+// that caused them. Nothing here allocates.
+
+enum {
+    GLDEBUG_MESSAGE = 160,  // longest example message kept per kind
+};
+
+enum gldebug_kind {
+    GLDEBUG_SYNC = 0,     // implicit synchronisation, stalls, waits
+    GLDEBUG_RECOMPILE,    // shader variants compiled at draw time
+    GLDEBUG_REALLOC,      // buffer or texture storage reallocated
+    GLDEBUG_PERFORMANCE,  // any other performance warning
+    GLDEBUG_ERROR,
+    GLDEBUG_OTHER,        // deprecation, portability, notifications, ...
+    GLDEBUG_KINDS,
+};
+
+struct FlappyGLDebug {
+    long frame[GLDEBUG_KINDS];   // messages in the current frame
+    long total[GLDEBUG_KINDS];   // messages since the last print
+    long frames[GLDEBUG_KINDS];  // frames with at least one message
+    long worst[GLDEBUG_KINDS];   // most messages in one frame
+    char example[GLDEBUG_KINDS][GLDEBUG_MESSAGE];  // first message of each kind
+};
+
+// needs a current context with opengl_has_debug(), returns false without it
+bool gldebug_install(struct FlappyGLDebug* debug);
+void gldebug_remove(struct FlappyGLDebug* debug);
+
+enum gldebug_kind gldebug_classify(unsigned int type, const char* message);
+
+// fold the current frame's counts into the totals
+void gldebug_end_frame(struct FlappyGLDebug* debug);
+
+// totals since the last print, then clears them
+void gldebug_print(struct FlappyGLDebug* debug, FILE* fp);
+
+#endif
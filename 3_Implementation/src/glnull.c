@@ -0,0 +1,220 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glnull.h"
+#include "opengl.h"
+
+// the backend glnull_load installed, stubs record into its log
+static struct FlappyGLNull* glnull_active = NULL;
+
+static void
+glnull_record(int function, const double* args, int argc)
+{
+    struct FlappyGLNull* gl = glnull_active;
+    if (gl->count == gl->capacity) {
+        gl->dropped++;
+        return;
+    }
+
+    struct GLNullCall* call = &gl->calls[gl->count++];
+    call->function = function;
+    call->argc = argc;
+    if (argc > 0) memcpy(call->args, args, argc * sizeof(double));
+}
+
+static GLuint
+glnull_create(void)
+{
+    return ++glnull_active->next_name;
+}
+
+static void
+glnull_generate(GLsizei n, GLuint* names)
+{
+    for (GLsizei i = 0; i < n; i++) {
+        names[i] = glnull_create();
+    }
+}
+
+static const GLubyte*
+glnull_glGetString(GLenum name)
+{
+    switch (name) {
+    case GL_VENDOR: return (const GLubyte*)"flappy";
+    case GL_RENDERER: return (const GLubyte*)"null";
+    case GL_VERSION: return (const GLubyte*)"3.3 null";
+    case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte*)"3.30";
+    default: return NULL;
+    }
+}
+
+static const GLubyte*
+glnull_glGetStringi(GLenum name, GLuint index)
+{
+    // there are no extensions
+    return NULL;
+}
+
+static void
+glnull_glGetIntegerv(GLenum pname, GLint* data)
+{
+    switch (pname) {
+    case GL_MAJOR_VERSION: *data = 3; break;
+    case GL_MINOR_VERSION: *data = 3; break;
+    default: *data = 0; break;
+    }
+}
+
+static void
+glnull_glGetShaderiv(GLuint shader, GLenum pname, GLint* params)
+{
+    *params = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+}
+
+static void
+glnull_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+    if (length != NULL) *length = 0;
+    if (bufSize > 0) infoLog[0] = '\0';
+}
+
+static void
+glnull_glGetProgramiv(GLuint program, GLenum pname, GLint* params)
+{
+    *params = pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS ? GL_TRUE : 0;
+}
+
+static void
+glnull_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+    if (length != NULL) *length = 0;
+    if (bufSize > 0) infoLog[0] = '\0';
+}
+
+static void*
+glnull_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    // writes land in scratch memory that is never read
+    struct FlappyGLNull* gl = glnull_active;
+    if (length > gl->mapped_size) {
+        void* mapped = realloc(gl->mapped, length);
+        if (mapped == NULL) return NULL;
+        gl->mapped = mapped;
+        gl->mapped_size = length;
+    }
+    return gl->mapped;
+}
+
+static GLboolean
+glnull_glUnmapBuffer(GLenum target)
+{
+    return GL_TRUE;
+}
+
+static void
+glnull_glGetQueryObjectiv(GLuint id, GLenum pname, GLint* params)
+{
+    // always available, the elapsed time is left at zero
+    *params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+}
+
+static GLenum
+glnull_glCheckFramebufferStatus(GLenum target)
+{
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+#include "opengl_null.h"
+
+static opengl_proc
+glnull_loader(const char* name)
+{
+    for (long i = 0; i < OPENGL_NULL_FUNCTIONS; i++) {
+        if (strcmp(OPENGL_NULL_NAMES[i], name) == 0) return OPENGL_NULL_PROCS[i];
+    }
+    return NULL;
+}
+
+bool
+glnull_load(struct FlappyGLNull* gl, long capacity)
+{
+    assert(gl != NULL);
+    assert(capacity >= 0);
+    assert(glnull_active == NULL);
+
+    memset(gl, 0, sizeof(*gl));
+    if (capacity > 0) {
+        gl->calls = malloc(capacity * sizeof(struct GLNullCall));
+        if (gl->calls == NULL) {
+            fprintf(stderr, "failed to allocate null GL call log\n");
+            return false;
+        }
+    }
+    gl->capacity = capacity;
+
+    glnull_active = gl;
+    if (!opengl_load_functions_from(glnull_loader)) {
+        glnull_unload(gl);
+        return false;
+    }
+    return true;
+}
+
+void
+glnull_unload(struct FlappyGLNull* gl)
+{
+    assert(gl != NULL);
+    assert(glnull_active == gl);
+
+    glnull_active = NULL;
+    free(gl->calls);
+    free(gl->mapped);
+    memset(gl, 0, sizeof(*gl));
+}
+
+void
+glnull_clear(struct FlappyGLNull* gl)
+{
+    assert(gl != NULL);
+
+    gl->count = 0;
+    gl->dropped = 0;
+}
+
+const char*
+glnull_name(const struct GLNullCall* call)
+{
+    assert(call != NULL);
+    assert(call->function >= 0 && call->function < OPENGL_NULL_FUNCTIONS);
+
+    return OPENGL_NULL_NAMES[call->function];
+}
+
+long
+glnull_find(const struct FlappyGLNull* gl, long from, const char* name)
+{
+    assert(gl != NULL);
+    assert(name != NULL);
+
+    for (long i = from; i < gl->count; i++) {
+        if (strcmp(glnull_name(&gl->calls[i]), name) == 0) return i;
+    }
+    return -1;
+}
+
+long
+glnull_count(const struct FlappyGLNull* gl, const char* name)
+{
+    assert(gl != NULL);
+    assert(name != NULL);
+
+    long count = 0;
+    for (long i = glnull_find(gl, 0, name); i >= 0; i = glnull_find(gl, i + 1, name)) {
+        count++;
+    }
+    return count;
+}
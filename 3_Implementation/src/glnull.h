@@ -0,0 +1,51 @@
+#ifndef FLAPPY_GLNULL_H_INCLUDED
+#define FLAPPY_GLNULL_H_INCLUDED
+
+#include <stdbool.h>
+
+// Null OpenGL backend. glnull_load points every OpenGL function at a stub
+// that does no rendering and appends the call to an in-memory log. Object
+// names are handed out from a counter, shaders always compile, mapped
+// buffers point at scratch memory and queries report ready and zero. No
+// display, context or driver is needed, so the CPU side of the renderer
+// can be benchmarked on its own and its call sequences unit tested.
+//
+// The stubs are generated from OPENGL_FUNCTIONS by scripts/glwrap.py --null
+// into opengl_null.h. Only one null backend can be loaded at a time.
+
+enum {
+    GLNULL_ARGS = 9,  // most arguments of any OpenGL function we use
+};
+
+struct GLNullCall {
+    int function;  // index into the generated function table
+    int argc;
+    // integers and floats as they were passed, pointers as addresses
+    double args[GLNULL_ARGS];
+};
+
+struct FlappyGLNull {
+    struct GLNullCall* calls;
+    long capacity;
+    long count;
+    long dropped;  // calls made after the log filled up
+
+    unsigned int next_name;  // last object name handed out
+    void* mapped;            // scratch memory behind glMapBufferRange
+    long mapped_size;
+};
+
+// capacity 0 keeps no log, for benchmarking the stubs alone
+bool glnull_load(struct FlappyGLNull* gl, long capacity);
+void glnull_unload(struct FlappyGLNull* gl);
+
+// empty the log, object names keep counting up
+void glnull_clear(struct FlappyGLNull* gl);
+
+const char* glnull_name(const struct GLNullCall* call);
+
+// index of the first call to the named function at or after from, -1 if none
+long glnull_find(const struct FlappyGLNull* gl, long from, const char* name);
+long glnull_count(const struct FlappyGLNull* gl, const char* name);
+
+#endif
@@ -0,0 +1,185 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glstate.h"
+#include "opengl.h"
+
+enum {
+    GLSTATE_CAP_BLEND = 0,
+    GLSTATE_CAP_DEPTH_TEST,
+    GLSTATE_CAP_CULL_FACE,
+    GLSTATE_CAPS,
+};
+
+enum {
+    GLSTATE_BUFFER_ARRAY = 0,
+    GLSTATE_BUFFER_UNIFORM,
+    GLSTATE_BUFFERS,
+};
+
+static struct {
+    unsigned int program;
+    unsigned int vao;
+    unsigned int buffers[GLSTATE_BUFFERS];
+    unsigned int active_unit;
+    unsigned int textures[GLSTATE_TEXTURE_UNITS];
+    unsigned int caps[GLSTATE_CAPS];
+    unsigned int blend_src;
+    unsigned int blend_dst;
+    unsigned int depth_func;
+    unsigned int depth_mask;
+
+    struct FlappyGLStats stats;
+} state;
+
+// returns true (and counts a skip) when value already matches
+static bool
+glstate_same(unsigned int* current, unsigned int value)
+{
+    if (*current == value) {
+        state.stats.skipped++;
+        return true;
+    }
+    *current = value;
+    state.stats.issued++;
+    return false;
+}
+
+static long
+glstate_buffer_slot(unsigned int target)
+{
+    switch (target) {
+    case GL_ARRAY_BUFFER:
+        return GLSTATE_BUFFER_ARRAY;
+    case GL_UNIFORM_BUFFER:
+        return GLSTATE_BUFFER_UNIFORM;
+    default:
+        return -1;
+    }
+}
+
+static long
+glstate_cap_slot(unsigned int cap)
+{
+    switch (cap) {
+    case GL_BLEND:
+        return GLSTATE_CAP_BLEND;
+    case GL_DEPTH_TEST:
+        return GLSTATE_CAP_DEPTH_TEST;
+    case GL_CULL_FACE:
+        return GLSTATE_CAP_CULL_FACE;
+    default:
+        return -1;
+    }
+}
+
+void
+glstate_forget(void)
+{
+    // no GL name or enum is all ones, so nothing matches until it is set again
+    struct FlappyGLStats stats = state.stats;
+    memset(&state, 0xff, sizeof(state));
+    state.stats = stats;
+}
+
+void
+glstate_use_program(unsigned int program)
+{
+    if (glstate_same(&state.program, program)) return;
+    glUseProgram(program);
+}
+
+void
+glstate_bind_vertex_array(unsigned int vao)
+{
+    if (glstate_same(&state.vao, vao)) return;
+    glBindVertexArray(vao);
+}
+
+void
+glstate_bind_buffer(unsigned int target, unsigned int buffer)
+{
+    long slot = glstate_buffer_slot(target);
+    if (slot < 0) {
+        // untracked target, always pass through
+        state.stats.issued++;
+        glBindBuffer(target, buffer);
+        return;
+    }
+
+    if (glstate_same(&state.buffers[slot], buffer)) return;
+    glBindBuffer(target, buffer);
+}
+
+void
+glstate_bind_texture(unsigned int unit, unsigned int texture)
+{
+    assert(unit < GLSTATE_TEXTURE_UNITS);
+
+    if (state.textures[unit] == texture) {
+        state.stats.skipped++;
+        return;
+    }
+    if (!glstate_same(&state.active_unit, unit)) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+    }
+    glstate_same(&state.textures[unit], texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void
+glstate_enable(unsigned int cap, bool enabled)
+{
+    long slot = glstate_cap_slot(cap);
+    if (slot >= 0 && glstate_same(&state.caps[slot], enabled)) return;
+    if (slot < 0) state.stats.issued++;
+
+    if (enabled) {
+        glEnable(cap);
+    } else {
+        glDisable(cap);
+    }
+}
+
+void
+glstate_blend_func(unsigned int src, unsigned int dst)
+{
+    if (state.blend_src == src && state.blend_dst == dst) {
+        state.stats.skipped++;
+        return;
+    }
+    state.blend_src = src;
+    state.blend_dst = dst;
+    state.stats.issued++;
+    glBlendFunc(src, dst);
+}
+
+void
+glstate_depth_func(unsigned int func)
+{
+    if (glstate_same(&state.depth_func, func)) return;
+    glDepthFunc(func);
+}
+
+void
+glstate_depth_mask(bool enabled)
+{
+    if (glstate_same(&state.depth_mask, enabled)) return;
+    glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+}
+
+void
+glstate_stats(struct FlappyGLStats* stats)
+{
+    assert(stats != NULL);
+    *stats = state.stats;
+}
+
+void
+glstate_stats_reset(void)
+{
+    memset(&state.stats, 0, sizeof(state.stats));
+}
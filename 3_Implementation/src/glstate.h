@@ -0,0 +1,37 @@
+#ifndef FLAPPY_GLSTATE_H_INCLUDED
+#define FLAPPY_GLSTATE_H_INCLUDED
+
+#include <stdbool.h>
+
+// Shadow copy of the GL binding and fixed-function state the game touches.
+// Each glstate_* call only reaches GL when the value actually changes.
+// Every bind in the renderer must go through here (or be followed by
+// glstate_forget) or the shadow copy goes stale.
+
+enum {
+    GLSTATE_TEXTURE_UNITS = 16,
+};
+
+struct FlappyGLStats {
+    long issued;   // calls that reached GL
+    long skipped;  // calls dropped because nothing would change
+};
+
+// mark everything unknown, so the next call for each piece of state is
+// issued; call once the context is current and after deleting bound objects
+void glstate_forget(void);
+
+void glstate_use_program(unsigned int program);
+void glstate_bind_vertex_array(unsigned int vao);
+void glstate_bind_buffer(unsigned int target, unsigned int buffer);
+void glstate_bind_texture(unsigned int unit, unsigned int texture);
+void glstate_enable(unsigned int cap, bool enabled);
+void glstate_blend_func(unsigned int src, unsigned int dst);
+void glstate_depth_func(unsigned int func);
+void glstate_depth_mask(bool enabled);
+
+// counters since the last glstate_stats_reset (the main loop resets them every frame)
+void glstate_stats(struct FlappyGLStats* stats);
+void glstate_stats_reset(void);
+
+#endif
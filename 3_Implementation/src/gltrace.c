@@ -0,0 +1,988 @@
+#include <assert.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gltrace.h"
+#include "opengl.h"
+
+enum {
+    GLTRACE_ALIGN = 8,             // payloads start on this boundary
+    GLTRACE_NULL = -1,             // payload size of a NULL pointer
+    GLTRACE_FRAMES_OFFSET = 20,    // where the frame count is in the header
+    GLTRACE_MAX_NAME = 1 << 24,    // larger object names mean a corrupt trace
+    GLTRACE_MAX_SOURCES = 16,      // strings in one glShaderSource
+    GLTRACE_MAX_USES = 3,          // calls a setup call needs kept before it
+};
+
+static const char GLTRACE_MAGIC[4] = { 'F', 'G', 'L', 'T' };
+
+// the trace being captured, the wrappers write into it
+static struct FlappyGLTrace* gltrace_active = NULL;
+
+// how a setup call is dropped once later calls make it redundant
+enum gltrace_slot {
+    GLTRACE_SLOT_NONE = 0,  // always kept
+    GLTRACE_SLOT_STATE,     // replaced by the next call with the same key
+    GLTRACE_SLOT_STORAGE,   // glBufferData of buffer key[0], replaces its storage and writes
+    GLTRACE_SLOT_WRITE,     // bytes [key[1], key[2]) of buffer key[0], replaced by covering writes
+};
+
+// a setup call held in memory until the first traced frame
+struct GLTraceRecord {
+    struct GLTraceRecord* prev;
+    struct GLTraceRecord* next;
+    int function;
+
+    int slot;
+    long key[3];
+    unsigned int value;  // name a binding call binds
+    bool replaced;
+
+    // calls kept for this one, which was made under the state they set
+    struct GLTraceRecord* uses[GLTRACE_MAX_USES];
+    int use_count;
+    long users;
+
+    unsigned char* data;
+    long size;
+    long capacity;
+    long* payloads;  // where each payload's bytes start in data, padded when written
+    long payload_count;
+    long payload_capacity;
+};
+
+static void
+gltrace_write(struct FlappyGLTrace* trace, const void* data, size_t size)
+{
+    if (size == 0) return;
+    if (fwrite(data, 1, size, trace->file) != size) trace->failed = true;
+    trace->bytes += size;
+}
+
+static void
+gltrace_write_padding(struct FlappyGLTrace* trace)
+{
+    static const unsigned char zeros[GLTRACE_ALIGN] = { 0 };
+
+    long pad = (GLTRACE_ALIGN - trace->bytes % GLTRACE_ALIGN) % GLTRACE_ALIGN;
+    gltrace_write(trace, zeros, pad);
+}
+
+static bool
+gltrace_record_grow(struct FlappyGLTrace* trace, struct GLTraceRecord* record, long size)
+{
+    if (size <= record->capacity) return true;
+
+    long capacity = record->capacity ? record->capacity : 64;
+    while (capacity < size) capacity *= 2;
+    unsigned char* grown = realloc(record->data, capacity);
+    if (grown == NULL) {
+        trace->failed = true;
+        return false;
+    }
+    record->data = grown;
+    record->capacity = capacity;
+    return true;
+}
+
+static void
+gltrace_put(const void* data, size_t size)
+{
+    struct FlappyGLTrace* trace = gltrace_active;
+    if (trace->in_range) {
+        gltrace_write(trace, data, size);
+        return;
+    }
+
+    struct GLTraceRecord* record = trace->last;
+    if (size == 0 || record == NULL || !gltrace_record_grow(trace, record, record->size + size)) return;
+    memcpy(record->data + record->size, data, size);
+    record->size += size;
+}
+
+static void
+gltrace_payload(const void* data, size_t size)
+{
+    struct FlappyGLTrace* trace = gltrace_active;
+    int32_t length = data != NULL ? (int32_t)size : GLTRACE_NULL;
+    gltrace_put(&length, sizeof(length));
+    if (data == NULL) return;
+
+    if (trace->in_range) {
+        gltrace_write_padding(trace);
+    } else if (trace->last != NULL) {
+        // the padding depends on where the call ends up in the file
+        struct GLTraceRecord* record = trace->last;
+        if (record->payload_count == record->payload_capacity) {
+            long capacity = record->payload_capacity ? record->payload_capacity * 2 : 4;
+            long* grown = realloc(record->payloads, capacity * sizeof(long));
+            if (grown == NULL) {
+                trace->failed = true;
+                return;
+            }
+            record->payloads = grown;
+            record->payload_capacity = capacity;
+        }
+        record->payloads[record->payload_count++] = record->size;
+    }
+    gltrace_put(data, size);
+}
+
+// false for calls left out of the trace
+static bool
+gltrace_call(int function);
+
+// bytes glTexImage2D reads, rows padded to the unpack alignment
+static size_t
+gltrace_image_size(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+    long components = 4;
+    switch (format) {
+    case GL_RED: case GL_DEPTH_COMPONENT: components = 1; break;
+    case GL_RG: components = 2; break;
+    case GL_RGB: case GL_BGR: components = 3; break;
+    }
+
+    long bytes = 4;
+    switch (type) {
+    case GL_UNSIGNED_BYTE: case GL_BYTE: bytes = 1; break;
+    case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: bytes = 2; break;
+    }
+
+    int alignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+
+    long row = width * components * bytes;
+    long stride = (row + alignment - 1) / alignment * alignment;
+    return height > 0 ? stride * (height - 1) + row : 0;
+}
+
+static void
+gltrace_fail(struct FlappyGLReplay* replay)
+{
+    if (!replay->failed) {
+        fprintf(stderr, "trace is truncated or corrupt at byte %ld\n", replay->position);
+    }
+    replay->failed = true;
+}
+
+static void
+gltrace_get(struct FlappyGLReplay* replay, void* value, size_t size)
+{
+    if (replay->failed || replay->position + (long)size > replay->size) {
+        gltrace_fail(replay);
+        memset(value, 0, size);
+        return;
+    }
+    memcpy(value, replay->data + replay->position, size);
+    replay->position += size;
+}
+
+// points into the trace, NULL for a NULL pointer
+static const void*
+gltrace_get_payload(struct FlappyGLReplay* replay)
+{
+    int32_t length = 0;
+    gltrace_get(replay, &length, sizeof(length));
+    replay->payload_size = 0;
+    if (replay->failed || length == GLTRACE_NULL) return NULL;
+
+    long start = (replay->position + GLTRACE_ALIGN - 1) / GLTRACE_ALIGN * GLTRACE_ALIGN;
+    if (length < 0 || start + length > replay->size) {
+        gltrace_fail(replay);
+        return NULL;
+    }
+    replay->position = start + length;
+    replay->payload_size = length;
+    return replay->data + start;
+}
+
+static GLuint
+gltrace_rename(struct FlappyGLReplay* replay, int kind, GLuint name)
+{
+    if (name == 0) return kind == GLTRACE_FRAMEBUFFER ? replay->default_framebuffer : 0;
+
+    // names the trace never created are passed through as they are
+    struct GLTraceNames* names = &replay->names[kind];
+    if (name < names->capacity && names->names[name] != 0) return names->names[name];
+    return name;
+}
+
+static void
+gltrace_name(struct FlappyGLReplay* replay, int kind, GLuint recorded, GLuint replayed)
+{
+    if (recorded == 0) return;
+    if (recorded >= GLTRACE_MAX_NAME) {
+        gltrace_fail(replay);
+        return;
+    }
+
+    struct GLTraceNames* names = &replay->names[kind];
+    if (recorded >= names->capacity) {
+        long capacity = names->capacity ? names->capacity : 64;
+        while (capacity <= recorded) capacity *= 2;
+
+        unsigned int* grown = realloc(names->names, capacity * sizeof(unsigned int));
+        if (grown == NULL) {
+            fprintf(stderr, "failed to allocate trace names\n");
+            replay->failed = true;
+            return;
+        }
+        memset(grown + names->capacity, 0, (capacity - names->capacity) * sizeof(unsigned int));
+        names->names = grown;
+        names->capacity = capacity;
+    }
+    names->names[recorded] = replayed;
+}
+
+// scratch array of n names, renamed from the recorded ones unless NULL
+static GLuint*
+gltrace_renamed(struct FlappyGLReplay* replay, int kind, const GLuint* recorded, GLsizei n)
+{
+    if (n > replay->scratch_capacity) {
+        unsigned int* grown = realloc(replay->scratch, n * sizeof(unsigned int));
+        if (grown == NULL) {
+            fprintf(stderr, "failed to allocate trace names\n");
+            replay->failed = true;
+            return replay->scratch;
+        }
+        replay->scratch = grown;
+        replay->scratch_capacity = n;
+    }
+
+    for (GLsizei i = 0; recorded != NULL && i < n; i++) {
+        replay->scratch[i] = gltrace_rename(replay, kind, recorded[i]);
+    }
+    return replay->scratch;
+}
+
+static long
+gltrace_relocate(struct FlappyGLReplay* replay, int kind, GLuint program, long recorded)
+{
+    if (recorded == -1) return recorded;
+
+    for (long i = 0; i < replay->location_count; i++) {
+        struct GLTraceLocation* location = &replay->locations[i];
+        if (location->kind == kind && location->program == program && location->recorded == recorded) {
+            return location->replayed;
+        }
+    }
+    return recorded;
+}
+
+static void
+gltrace_located(struct FlappyGLReplay* replay, int kind, GLuint program, long recorded, long replayed)
+{
+    if (replay->location_count == replay->location_capacity) {
+        long capacity = replay->location_capacity ? replay->location_capacity * 2 : 32;
+        struct GLTraceLocation* grown = realloc(replay->locations, capacity * sizeof(struct GLTraceLocation));
+        if (grown == NULL) {
+            fprintf(stderr, "failed to allocate trace locations\n");
+            replay->failed = true;
+            return;
+        }
+        replay->locations = grown;
+        replay->location_capacity = capacity;
+    }
+
+    struct GLTraceLocation* location = &replay->locations[replay->location_count++];
+    location->kind = kind;
+    location->program = program;
+    location->recorded = recorded;
+    location->replayed = replayed;
+}
+
+#include "opengl_trace.h"
+
+// next scalar argument of a held call
+static void
+gltrace_record_arg(const struct GLTraceRecord* record, long* position, void* value, size_t size)
+{
+    memset(value, 0, size);
+    if (*position + (long)size <= record->size) memcpy(value, record->data + *position, size);
+    *position += size;
+}
+
+// the last held call with the key, which is still in effect
+static struct GLTraceRecord*
+gltrace_record_latest(struct GLTraceRecord* before, int function, long a)
+{
+    for (struct GLTraceRecord* record = before; record != NULL; record = record->prev) {
+        if (record->slot == GLTRACE_SLOT_STATE && record->key[0] == function && record->key[1] == a) return record;
+    }
+    return NULL;
+}
+
+// glBindBufferBase binds the generic target too
+static struct GLTraceRecord*
+gltrace_record_buffer(struct GLTraceRecord* before, GLenum target)
+{
+    for (struct GLTraceRecord* record = before; record != NULL; record = record->prev) {
+        if ((record->function == OPENGL_TRACE_GLBINDBUFFER || record->function == OPENGL_TRACE_GLBINDBUFFERBASE) &&
+            record->key[1] == (long)target) {
+            return record;
+        }
+    }
+    return NULL;
+}
+
+static void
+gltrace_record_use(struct GLTraceRecord* record, struct GLTraceRecord* used)
+{
+    if (used == NULL) return;
+    assert(record->use_count < GLTRACE_MAX_USES);
+    record->uses[record->use_count++] = used;
+    used->users++;
+}
+
+static void
+gltrace_record_key(struct GLTraceRecord* record, int slot, long key0, long key1, long key2)
+{
+    record->slot = slot;
+    record->key[0] = key0;
+    record->key[1] = key1;
+    record->key[2] = key2;
+}
+
+// the texture unit glActiveTexture selected, and the call that did
+static long
+gltrace_record_unit(struct GLTraceRecord* record)
+{
+    struct GLTraceRecord* active = gltrace_record_latest(record->prev, OPENGL_TRACE_GLACTIVETEXTURE, 0);
+    gltrace_record_use(record, active);
+    return active != NULL ? (long)active->value - GL_TEXTURE0 : 0;
+}
+
+// the texture a texture call works on, and the calls that bound it
+static long
+gltrace_record_texture(struct GLTraceRecord* record, GLenum target)
+{
+    long unit = gltrace_record_unit(record);
+    long texture = 0;
+    for (struct GLTraceRecord* bind = record->prev; bind != NULL; bind = bind->prev) {
+        if (bind->slot == GLTRACE_SLOT_STATE && bind->key[0] == OPENGL_TRACE_GLBINDTEXTURE &&
+            bind->key[1] == unit && bind->key[2] == (long)target) {
+            gltrace_record_use(record, bind);
+            texture = bind->value;
+            break;
+        }
+    }
+    return texture;
+}
+
+// works out what a held call sets and which earlier calls it needs
+static void
+gltrace_record_describe(struct GLTraceRecord* record)
+{
+    long position = sizeof(uint16_t);
+    GLenum target = 0;
+    GLenum pname = 0;
+    GLint location = 0;
+    GLintptr offset = 0;
+    GLsizeiptr size = 0;
+
+    int function = record->function;
+    switch (function) {
+    case OPENGL_TRACE_GLVIEWPORT:
+    case OPENGL_TRACE_GLCLEARCOLOR:
+    case OPENGL_TRACE_GLDEPTHFUNC:
+    case OPENGL_TRACE_GLDEPTHMASK:
+    case OPENGL_TRACE_GLCULLFACE:
+    case OPENGL_TRACE_GLBLENDFUNC:
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, function, 0, 0);
+        break;
+    case OPENGL_TRACE_GLUSEPROGRAM:
+    case OPENGL_TRACE_GLBINDVERTEXARRAY:
+    case OPENGL_TRACE_GLACTIVETEXTURE:
+        gltrace_record_arg(record, &position, &record->value, sizeof(GLuint));
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, function, 0, 0);
+        break;
+    case OPENGL_TRACE_GLENABLE:
+    case OPENGL_TRACE_GLDISABLE:
+        gltrace_record_arg(record, &position, &pname, sizeof(pname));
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, OPENGL_TRACE_GLENABLE, pname, 0);
+        break;
+    case OPENGL_TRACE_GLPIXELSTOREI:
+    case OPENGL_TRACE_GLPOLYGONMODE:
+        gltrace_record_arg(record, &position, &pname, sizeof(pname));
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, function, pname, 0);
+        break;
+    case OPENGL_TRACE_GLBINDBUFFER:
+    case OPENGL_TRACE_GLBINDFRAMEBUFFER:
+    case OPENGL_TRACE_GLBINDRENDERBUFFER:
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        gltrace_record_arg(record, &position, &record->value, sizeof(GLuint));
+        if (target == GL_ELEMENT_ARRAY_BUFFER) {
+            // part of the vertex array, which must stay bound before it
+            gltrace_record_use(record, gltrace_record_latest(record->prev, OPENGL_TRACE_GLBINDVERTEXARRAY, 0));
+            gltrace_record_key(record, GLTRACE_SLOT_NONE, function, target, 0);
+            break;
+        }
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, function, target, 0);
+        break;
+    case OPENGL_TRACE_GLBINDBUFFERBASE: {
+        GLuint index = 0;
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        gltrace_record_arg(record, &position, &index, sizeof(index));
+        gltrace_record_arg(record, &position, &record->value, sizeof(GLuint));
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, function, target, index);
+        break;
+    }
+    case OPENGL_TRACE_GLBINDTEXTURE: {
+        long unit = gltrace_record_unit(record);
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        gltrace_record_arg(record, &position, &record->value, sizeof(GLuint));
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, function, unit, target);
+        break;
+    }
+    case OPENGL_TRACE_GLUNIFORM1I:
+    case OPENGL_TRACE_GLUNIFORM1F:
+    case OPENGL_TRACE_GLUNIFORM2F:
+    case OPENGL_TRACE_GLUNIFORM3F:
+    case OPENGL_TRACE_GLUNIFORM3FV:
+    case OPENGL_TRACE_GLUNIFORMMATRIX4FV: {
+        struct GLTraceRecord* program = gltrace_record_latest(record->prev, OPENGL_TRACE_GLUSEPROGRAM, 0);
+        gltrace_record_use(record, program);
+        gltrace_record_arg(record, &position, &location, sizeof(location));
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, OPENGL_TRACE_GLUNIFORM1I,
+            program != NULL ? program->value : 0, location);
+        break;
+    }
+    case OPENGL_TRACE_GLBUFFERDATA:
+    case OPENGL_TRACE_GLBUFFERSUBDATA: {
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        struct GLTraceRecord* bind = gltrace_record_buffer(record->prev, target);
+        gltrace_record_use(record, bind);
+        if (bind == NULL || bind->value == 0) break;
+
+        if (function == OPENGL_TRACE_GLBUFFERDATA) {
+            gltrace_record_key(record, GLTRACE_SLOT_STORAGE, bind->value, 0, 0);
+        } else {
+            gltrace_record_arg(record, &position, &offset, sizeof(offset));
+            gltrace_record_arg(record, &position, &size, sizeof(size));
+            gltrace_record_key(record, GLTRACE_SLOT_WRITE, bind->value, offset, offset + size);
+        }
+        break;
+    }
+    case OPENGL_TRACE_GLMAPBUFFERRANGE: {
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        struct GLTraceRecord* bind = gltrace_record_buffer(record->prev, target);
+        gltrace_record_use(record, bind);
+        record->value = bind != NULL ? bind->value : 0;
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, function, target, 0);
+        break;
+    }
+    case OPENGL_TRACE_GLUNMAPBUFFER: {
+        // the write is the range glMapBufferRange mapped
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        struct GLTraceRecord* map = gltrace_record_latest(record->prev, OPENGL_TRACE_GLMAPBUFFERRANGE, target);
+        gltrace_record_use(record, map);
+        if (map == NULL || map->value == 0) break;
+
+        GLbitfield access = 0;
+        position = sizeof(uint16_t) + sizeof(target);
+        gltrace_record_arg(map, &position, &offset, sizeof(offset));
+        gltrace_record_arg(map, &position, &size, sizeof(size));
+        gltrace_record_arg(map, &position, &access, sizeof(access));
+        if (access & GL_MAP_INVALIDATE_BUFFER_BIT) {
+            gltrace_record_key(record, GLTRACE_SLOT_WRITE, map->value, 0, LONG_MAX);
+        } else {
+            gltrace_record_key(record, GLTRACE_SLOT_WRITE, map->value, offset, offset + size);
+        }
+        break;
+    }
+    case OPENGL_TRACE_GLTEXIMAGE2D:
+    case OPENGL_TRACE_GLTEXPARAMETERI:
+    case OPENGL_TRACE_GLGENERATEMIPMAP: {
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        long texture = gltrace_record_texture(record, target);
+        if (function != OPENGL_TRACE_GLGENERATEMIPMAP) {
+            // the level or the parameter
+            gltrace_record_arg(record, &position, &pname, sizeof(pname));
+        }
+        if (function == OPENGL_TRACE_GLTEXIMAGE2D) {
+            gltrace_record_use(record, gltrace_record_latest(record->prev, OPENGL_TRACE_GLPIXELSTOREI, GL_UNPACK_ALIGNMENT));
+        }
+        if (texture != 0) gltrace_record_key(record, GLTRACE_SLOT_STATE, function, texture, pname);
+        break;
+    }
+    case OPENGL_TRACE_GLVERTEXATTRIBPOINTER:
+    case OPENGL_TRACE_GLVERTEXATTRIBDIVISOR:
+    case OPENGL_TRACE_GLENABLEVERTEXATTRIBARRAY:
+    case OPENGL_TRACE_GLDISABLEVERTEXATTRIBARRAY: {
+        struct GLTraceRecord* array = gltrace_record_latest(record->prev, OPENGL_TRACE_GLBINDVERTEXARRAY, 0);
+        gltrace_record_use(record, array);
+        if (function == OPENGL_TRACE_GLVERTEXATTRIBPOINTER) {
+            gltrace_record_use(record, gltrace_record_buffer(record->prev, GL_ARRAY_BUFFER));
+        }
+        if (function == OPENGL_TRACE_GLDISABLEVERTEXATTRIBARRAY) function = OPENGL_TRACE_GLENABLEVERTEXATTRIBARRAY;
+
+        GLuint index = 0;
+        gltrace_record_arg(record, &position, &index, sizeof(index));
+        gltrace_record_key(record, GLTRACE_SLOT_STATE, function, array != NULL ? array->value : 0, index);
+        break;
+    }
+    case OPENGL_TRACE_GLFRAMEBUFFERRENDERBUFFER:
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        gltrace_record_use(record, gltrace_record_latest(record->prev, OPENGL_TRACE_GLBINDFRAMEBUFFER, target));
+        break;
+    case OPENGL_TRACE_GLRENDERBUFFERSTORAGE:
+        gltrace_record_arg(record, &position, &target, sizeof(target));
+        gltrace_record_use(record, gltrace_record_latest(record->prev, OPENGL_TRACE_GLBINDRENDERBUFFER, target));
+        break;
+    default:
+        // creating, deleting, compiling and linking objects, always kept
+        break;
+    }
+}
+
+static bool
+gltrace_record_replaces(const struct GLTraceRecord* record, const struct GLTraceRecord* old)
+{
+    switch (record->slot) {
+    case GLTRACE_SLOT_STATE:
+        return old->slot == GLTRACE_SLOT_STATE && old->key[0] == record->key[0] &&
+            old->key[1] == record->key[1] && old->key[2] == record->key[2];
+    case GLTRACE_SLOT_STORAGE:
+        return (old->slot == GLTRACE_SLOT_STORAGE || old->slot == GLTRACE_SLOT_WRITE) && old->key[0] == record->key[0];
+    case GLTRACE_SLOT_WRITE:
+        return old->slot == GLTRACE_SLOT_WRITE && old->key[0] == record->key[0] &&
+            record->key[1] <= old->key[1] && old->key[2] <= record->key[2];
+    }
+    return false;
+}
+
+static void
+gltrace_record_free(struct GLTraceRecord* record)
+{
+    free(record->payloads);
+    free(record->data);
+    free(record);
+}
+
+// drops a replaced call once no kept call needs it
+static void
+gltrace_record_release(struct FlappyGLTrace* trace, struct GLTraceRecord* record)
+{
+    if (!record->replaced || record->users > 0) return;
+
+    if (record->prev != NULL) record->prev->next = record->next;
+    else trace->setup = record->next;
+    if (record->next != NULL) record->next->prev = record->prev;
+    else trace->last = record->prev;
+
+    for (int i = 0; i < record->use_count; i++) {
+        record->uses[i]->users--;
+        gltrace_record_release(trace, record->uses[i]);
+    }
+    gltrace_record_free(record);
+}
+
+// called once the last held call has all its arguments
+static void
+gltrace_record_finish(struct FlappyGLTrace* trace)
+{
+    struct GLTraceRecord* record = trace->last;
+    if (record == NULL || record->slot >= 0) return;
+
+    record->slot = GLTRACE_SLOT_NONE;
+    gltrace_record_describe(record);
+    if (record->slot == GLTRACE_SLOT_NONE) return;
+
+    // only releases calls before this one, so the next one stays valid
+    struct GLTraceRecord* next = NULL;
+    for (struct GLTraceRecord* old = trace->setup; old != record; old = next) {
+        next = old->next;
+        if (!old->replaced && gltrace_record_replaces(record, old)) {
+            old->replaced = true;
+            gltrace_record_release(trace, old);
+        }
+    }
+}
+
+// true for a kept call that sets the same state as the kept call before it
+static bool
+gltrace_record_redundant(const struct GLTraceRecord* record)
+{
+    if (record->slot != GLTRACE_SLOT_STATE || record->payload_count > 0) return false;
+
+    for (const struct GLTraceRecord* old = record->prev; old != NULL; old = old->prev) {
+        if (gltrace_record_replaces(record, old)) {
+            return old->size == record->size && memcmp(old->data, record->data, record->size) == 0;
+        }
+    }
+    return false;
+}
+
+// writes the held calls, in the order they were made
+static void
+gltrace_record_flush(struct FlappyGLTrace* trace)
+{
+    gltrace_record_finish(trace);
+
+    for (struct GLTraceRecord* record = trace->setup; record != NULL; record = record->next) {
+        if (gltrace_record_redundant(record)) continue;
+
+        long position = 0;
+        for (long i = 0; i < record->payload_count; i++) {
+            gltrace_write(trace, record->data + position, record->payloads[i] - position);
+            gltrace_write_padding(trace);
+            position = record->payloads[i];
+        }
+        gltrace_write(trace, record->data + position, record->size - position);
+        trace->setup_calls++;
+    }
+
+    struct GLTraceRecord* next = NULL;
+    for (struct GLTraceRecord* record = trace->setup; record != NULL; record = next) {
+        next = record->next;
+        gltrace_record_free(record);
+    }
+    trace->setup = NULL;
+    trace->last = NULL;
+}
+
+static bool
+gltrace_call(int function)
+{
+    struct FlappyGLTrace* trace = gltrace_active;
+    if (trace == NULL) return false;
+
+    uint16_t index = function;
+    if (trace->in_range) {
+        gltrace_write(trace, &index, sizeof(index));
+        trace->frame_calls++;
+        return true;
+    }
+    if (OPENGL_TRACE_FRAME_ONLY[function]) return false;
+
+    gltrace_record_finish(trace);
+    struct GLTraceRecord* record = calloc(1, sizeof(*record));
+    if (record == NULL) {
+        trace->failed = true;
+        return false;
+    }
+    record->function = function;
+    record->slot = -1;  // until gltrace_record_finish
+
+    record->prev = trace->last;
+    if (trace->last != NULL) trace->last->next = record;
+    else trace->setup = record;
+    trace->last = record;
+
+    gltrace_put(&index, sizeof(index));
+    return true;
+}
+
+static void APIENTRY
+glShaderSource_traced(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+    glShaderSource_driver(shader, count, string, length);
+    if (gltrace_call(OPENGL_TRACE_GLSHADERSOURCE)) {
+        gltrace_put(&shader, sizeof(shader));
+        gltrace_put(&count, sizeof(count));
+        for (GLsizei i = 0; i < count; i++) {
+            size_t size = length != NULL && length[i] >= 0 ? (size_t)length[i] : strlen(string[i]);
+            gltrace_payload(string[i], size);
+        }
+    }
+}
+
+static void
+gltrace_replay_glShaderSource(struct FlappyGLReplay* replay)
+{
+    GLuint shader = 0;
+    GLsizei count = 0;
+    gltrace_get(replay, &shader, sizeof(shader));
+    gltrace_get(replay, &count, sizeof(count));
+    if (count < 0 || count > GLTRACE_MAX_SOURCES) {
+        gltrace_fail(replay);
+        return;
+    }
+
+    const GLchar* strings[GLTRACE_MAX_SOURCES];
+    GLint lengths[GLTRACE_MAX_SOURCES];
+    for (GLsizei i = 0; i < count; i++) {
+        strings[i] = gltrace_get_payload(replay);
+        lengths[i] = replay->payload_size;
+    }
+    if (replay->failed) return;
+
+    glShaderSource(gltrace_rename(replay, GLTRACE_PROGRAM, shader), count, strings, lengths);
+}
+
+static void* APIENTRY
+glMapBufferRange_traced(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    void* result = glMapBufferRange_driver(target, offset, length, access);
+    if (gltrace_call(OPENGL_TRACE_GLMAPBUFFERRANGE)) {
+        gltrace_put(&target, sizeof(target));
+        gltrace_put(&offset, sizeof(offset));
+        gltrace_put(&length, sizeof(length));
+        gltrace_put(&access, sizeof(access));
+    }
+    gltrace_active->mapped = result;
+    gltrace_active->mapped_length = length;
+    return result;
+}
+
+static void
+gltrace_replay_glMapBufferRange(struct FlappyGLReplay* replay)
+{
+    GLenum target = 0;
+    GLintptr offset = 0;
+    GLsizeiptr length = 0;
+    GLbitfield access = 0;
+    gltrace_get(replay, &target, sizeof(target));
+    gltrace_get(replay, &offset, sizeof(offset));
+    gltrace_get(replay, &length, sizeof(length));
+    gltrace_get(replay, &access, sizeof(access));
+    if (replay->failed) return;
+
+    replay->mapped = glMapBufferRange(target, offset, length, access);
+    replay->mapped_length = replay->mapped != NULL ? length : 0;
+}
+
+// the contents are read back just before unmapping, the game only writes
+// mapped buffers between the two calls
+static GLboolean APIENTRY
+glUnmapBuffer_traced(GLenum target)
+{
+    if (gltrace_call(OPENGL_TRACE_GLUNMAPBUFFER)) {
+        gltrace_put(&target, sizeof(target));
+        gltrace_payload(gltrace_active->mapped, gltrace_active->mapped_length);
+    }
+    gltrace_active->mapped = NULL;
+    gltrace_active->mapped_length = 0;
+    return glUnmapBuffer_driver(target);
+}
+
+static void
+gltrace_replay_glUnmapBuffer(struct FlappyGLReplay* replay)
+{
+    GLenum target = 0;
+    gltrace_get(replay, &target, sizeof(target));
+    const void* data = gltrace_get_payload(replay);
+    if (replay->failed) return;
+
+    if (data != NULL && replay->mapped != NULL) {
+        long size = replay->payload_size < replay->mapped_length ? replay->payload_size : replay->mapped_length;
+        memcpy(replay->mapped, data, size);
+    }
+    replay->mapped = NULL;
+    replay->mapped_length = 0;
+    glUnmapBuffer(target);
+}
+
+static void
+gltrace_marker(struct FlappyGLTrace* trace)
+{
+    uint16_t marker = GLTRACE_FRAME;
+    gltrace_write(trace, &marker, sizeof(marker));
+}
+
+bool
+gltrace_start(struct FlappyGLTrace* trace, const char* path, long width, long height, bool depth, long first, long count)
+{
+    assert(trace != NULL);
+    assert(path != NULL);
+    assert(gltrace_active == NULL);
+
+    memset(trace, 0, sizeof(*trace));
+    if (first < 0 || count <= 0) {
+        fprintf(stderr, "invalid trace frames: %ld:%ld\n", first, count);
+        return false;
+    }
+
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "failed to open trace file: %s\n", path);
+        return false;
+    }
+    trace->file = file;
+    trace->path = path;
+    trace->first = first;
+    trace->count = count;
+    gltrace_active = trace;
+
+    uint32_t header[] = { GLTRACE_VERSION, width, height, depth, 0, OPENGL_TRACE_FUNCTIONS };
+    gltrace_write(trace, GLTRACE_MAGIC, sizeof(GLTRACE_MAGIC));
+    gltrace_write(trace, header, sizeof(header));
+    for (long i = 0; i < OPENGL_TRACE_FUNCTIONS; i++) {
+        uint8_t length = strlen(OPENGL_TRACE_NAMES[i]);
+        gltrace_write(trace, &length, sizeof(length));
+        gltrace_write(trace, OPENGL_TRACE_NAMES[i], length);
+    }
+
+    // there is no setup when tracing from the first frame
+    if (first == 0) {
+        gltrace_marker(trace);
+        trace->in_range = true;
+    }
+
+    opengl_trace_install();
+    return true;
+}
+
+void
+gltrace_frame(struct FlappyGLTrace* trace)
+{
+    assert(trace != NULL);
+    if (trace->file == NULL) return;
+
+    trace->frame++;
+    if (trace->in_range) {
+        gltrace_marker(trace);
+        trace->frames++;
+        if (trace->frames == trace->count) gltrace_stop(trace);
+    } else if (trace->frame == trace->first) {
+        gltrace_record_flush(trace);
+        gltrace_marker(trace);
+        trace->in_range = true;
+    }
+}
+
+bool
+gltrace_stop(struct FlappyGLTrace* trace)
+{
+    assert(trace != NULL);
+    if (trace->file == NULL) return !trace->failed;
+
+    opengl_trace_uninstall();
+    gltrace_active = NULL;
+    if (!trace->in_range) gltrace_record_flush(trace);
+
+    FILE* file = trace->file;
+    trace->file = NULL;
+
+    uint32_t frames = trace->frames;
+    if (fseek(file, GLTRACE_FRAMES_OFFSET, SEEK_SET) != 0 || fwrite(&frames, sizeof(frames), 1, file) != 1) {
+        trace->failed = true;
+    }
+    if (fclose(file) != 0) trace->failed = true;
+
+    if (trace->failed) {
+        fprintf(stderr, "failed to write trace file: %s\n", trace->path);
+        return false;
+    }
+    return true;
+}
+
+bool
+gltrace_replay_open(struct FlappyGLReplay* replay, const unsigned char* data, long size, unsigned int framebuffer)
+{
+    assert(replay != NULL);
+    assert(data != NULL);
+
+    memset(replay, 0, sizeof(*replay));
+    replay->data = data;
+    replay->size = size;
+    replay->default_framebuffer = framebuffer;
+
+    char magic[sizeof(GLTRACE_MAGIC)];
+    uint32_t header[6];
+    gltrace_get(replay, magic, sizeof(magic));
+    gltrace_get(replay, header, sizeof(header));
+    if (replay->failed) return false;
+    if (memcmp(magic, GLTRACE_MAGIC, sizeof(magic)) != 0 || header[0] != GLTRACE_VERSION) {
+        fprintf(stderr, "not a version %d GL trace\n", GLTRACE_VERSION);
+        replay->failed = true;
+        return false;
+    }
+
+    replay->width = header[1];
+    replay->height = header[2];
+    replay->depth = header[3];
+    replay->frames = header[4];
+    replay->function_count = header[5];
+
+    replay->functions = malloc(replay->function_count * sizeof(int));
+    if (replay->functions == NULL) {
+        fprintf(stderr, "failed to allocate trace functions\n");
+        replay->failed = true;
+        return false;
+    }
+
+    // traces name their functions, so they outlive changes to the list
+    for (long i = 0; i < replay->function_count; i++) {
+        uint8_t length = 0;
+        char name[256];
+        gltrace_get(replay, &length, sizeof(length));
+        gltrace_get(replay, name, length);
+        name[length] = '\0';
+        if (replay->failed) return false;
+
+        replay->functions[i] = -1;
+        for (int f = 0; f < OPENGL_TRACE_FUNCTIONS; f++) {
+            if (strcmp(OPENGL_TRACE_NAMES[f], name) == 0) replay->functions[i] = f;
+        }
+        if (replay->functions[i] < 0) {
+            fprintf(stderr, "trace calls %s, which this build can't replay\n", name);
+            replay->failed = true;
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+gltrace_replay_close(struct FlappyGLReplay* replay)
+{
+    assert(replay != NULL);
+
+    for (long kind = 0; kind < GLTRACE_KINDS; kind++) {
+        free(replay->names[kind].names);
+    }
+    free(replay->locations);
+    free(replay->functions);
+    free(replay->scratch);
+    memset(replay, 0, sizeof(*replay));
+}
+
+// issue calls up to the next frame marker, false without one
+static bool
+gltrace_replay_until_frame(struct FlappyGLReplay* replay)
+{
+    while (!replay->failed && replay->position < replay->size) {
+        uint16_t index = 0;
+        gltrace_get(replay, &index, sizeof(index));
+        if (index == GLTRACE_FRAME) return true;
+        if (index >= replay->function_count) {
+            gltrace_fail(replay);
+            break;
+        }
+        gltrace_replay_call(replay, replay->functions[index]);
+    }
+    return false;
+}
+
+bool
+gltrace_replay_setup(struct FlappyGLReplay* replay)
+{
+    assert(replay != NULL);
+
+    if (!gltrace_replay_until_frame(replay)) {
+        gltrace_fail(replay);
+        return false;
+    }
+    replay->frames_start = replay->position;
+    return true;
+}
+
+bool
+gltrace_replay_frame(struct FlappyGLReplay* replay)
+{
+    assert(replay != NULL);
+    return gltrace_replay_until_frame(replay);
+}
+
+void
+gltrace_replay_rewind(struct FlappyGLReplay* replay)
+{
+    assert(replay != NULL);
+    replay->position = replay->frames_start;
+}
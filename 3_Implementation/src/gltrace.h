@@ -0,0 +1,148 @@
+#ifndef FLAPPY_GLTRACE_H_INCLUDED
+#define FLAPPY_GLTRACE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Binary capture of every OpenGL call over a range of frames, for replay
+// against another driver by flappy-replay-gl. A trace is:
+//
+//   "FGLT", version, width, height, depth buffer, frame count,
+//   function count, the function names (length byte + name),
+//   then the calls
+//
+// All numbers are 32 bit, native byte order. Each call is its 16 bit index
+// into the name table, its scalar arguments in their native size, then for
+// each pointer argument a 32 bit byte count (all ones for NULL), padding
+// to a multiple of 8 bytes from the start of the file, and the bytes it
+// points at. Mapped buffer writes are stored with glUnmapBuffer. Calls that
+// only read state back (glGet*, glReadPixels) are left out.
+//
+// Calls before the first traced frame are the setup, so the trace starts
+// with every object the traced frames use. Clears, draws and queries are
+// left out of it, and it is held in memory until the first traced frame
+// so that calls later ones made redundant can be dropped: what creates and
+// fills objects is kept, but of the calls setting a binding, capability,
+// uniform or buffer range only the last one is (plus any earlier binding a
+// kept call was made under). The setup is about the same size whichever
+// frame the trace starts at. A frame marker (index GLTRACE_FRAME) ends the
+// setup and each traced frame.
+//
+// The capture and replay code is generated from OPENGL_FUNCTIONS by
+// scripts/glwrap.py --trace into opengl_trace.h. Only one trace can be
+// captured at a time.
+
+enum {
+    GLTRACE_VERSION = 1,
+    GLTRACE_FRAME = 0xffff,
+};
+
+// object namespaces renamed on replay
+enum gltrace_kind {
+    GLTRACE_BUFFER = 0,
+    GLTRACE_TEXTURE,
+    GLTRACE_PROGRAM,  // shaders and programs share names
+    GLTRACE_VERTEX_ARRAY,
+    GLTRACE_QUERY,
+    GLTRACE_FRAMEBUFFER,
+    GLTRACE_RENDERBUFFER,
+    GLTRACE_KINDS,
+};
+
+// per program values looked up by name, which differ between drivers
+enum gltrace_location_kind {
+    GLTRACE_LOCATION = 0,
+    GLTRACE_BLOCK,
+};
+
+struct GLTraceRecord;
+
+struct FlappyGLTrace {
+    void* file;  // FILE*, NULL once stopped
+    const char* path;
+    long first;  // frames traced
+    long count;
+    long frame;  // frames finished so far
+    long frames;  // frames traced so far
+    bool in_range;
+
+    long setup_calls;  // written, after dropping the redundant ones
+    long frame_calls;
+    long bytes;
+    bool failed;  // a write or an allocation failed
+
+    // setup calls held until the first traced frame, oldest first
+    struct GLTraceRecord* setup;
+    struct GLTraceRecord* last;
+
+    // mapping whose contents are written at glUnmapBuffer
+    void* mapped;
+    long mapped_length;
+};
+
+struct GLTraceNames {
+    unsigned int* names;  // replayed name by recorded name, 0 unknown
+    long capacity;
+};
+
+struct GLTraceLocation {
+    int kind;
+    unsigned int program;  // recorded program
+    long recorded;
+    long replayed;
+};
+
+struct FlappyGLReplay {
+    const unsigned char* data;
+    long size;
+    long position;
+    bool failed;
+
+    long width;
+    long height;
+    bool depth;
+    long frames;
+    long frames_start;  // position after the setup
+
+    int* functions;  // local function by trace function
+    long function_count;
+
+    struct GLTraceNames names[GLTRACE_KINDS];
+    struct GLTraceLocation* locations;
+    long location_count;
+    long location_capacity;
+    unsigned int program;  // recorded program in use
+    unsigned int default_framebuffer;  // stands in for framebuffer 0
+
+    void* mapped;
+    long mapped_length;
+    long payload_size;  // bytes behind the last payload read
+    unsigned int* scratch;
+    long scratch_capacity;
+};
+
+// Trace frames [first, first + count) to path. Call with the context
+// current and before any object the frames use is created; every GL call
+// goes through the trace until gltrace_stop.
+bool gltrace_start(struct FlappyGLTrace* trace, const char* path, long width, long height, bool depth, long first, long count);
+
+// call once at the end of every frame, stops after the last traced frame
+void gltrace_frame(struct FlappyGLTrace* trace);
+
+// puts the driver functions back and finishes the file, false if writing failed
+bool gltrace_stop(struct FlappyGLTrace* trace);
+
+// reads the header of a trace in data, which must outlive the replay;
+// framebuffer stands in for the default framebuffer of the traced context
+bool gltrace_replay_open(struct FlappyGLReplay* replay, const unsigned char* data, long size, unsigned int framebuffer);
+void gltrace_replay_close(struct FlappyGLReplay* replay);
+
+// Issue the setup calls, then one traced frame per gltrace_replay_frame
+// until it returns false. replay->failed tells a corrupt trace from the end.
+bool gltrace_replay_setup(struct FlappyGLReplay* replay);
+bool gltrace_replay_frame(struct FlappyGLReplay* replay);
+
+// back to the first frame, to replay the frames again
+void gltrace_replay_rewind(struct FlappyGLReplay* replay);
+
+#endif
@@ -0,0 +1,256 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "glstate.h"
+#include "headless.h"
+#include "opengl.h"
+
+enum {
+    HEADLESS_TOLERANCE = 2,  // per channel difference still matching a golden image
+};
+
+static const double HEADLESS_MISMATCH = 0.001;  // fraction of channels allowed past the tolerance
+
+// prefer Mesa's surfaceless platform, which needs no X11 or Wayland
+// server and no DRM device; otherwise take whatever the default is
+static EGLDisplay
+headless_display(void)
+{
+    const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    if (extensions != NULL && strstr(extensions, "EGL_MESA_platform_surfaceless") != NULL && get_platform_display != NULL) {
+        return get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+static opengl_proc
+headless_proc(const char* name)
+{
+    return (opengl_proc)eglGetProcAddress(name);
+}
+
+bool
+headless_create(struct FlappyHeadless* headless, long width, long height, bool depth, bool debug)
+{
+    assert(headless != NULL);
+    assert(width > 0 && height > 0);
+
+    memset(headless, 0, sizeof(*headless));
+    headless->width = width;
+    headless->height = height;
+
+    EGLDisplay display = headless_display();
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL)) {
+        fprintf(stderr, "failed to init EGL display: 0x%x\n", eglGetError());
+        return false;
+    }
+    headless->display = display;
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        fprintf(stderr, "EGL has no desktop OpenGL\n");
+        headless_destroy(headless);
+        return false;
+    }
+
+    // nothing is ever presented, so any config that renders OpenGL will do
+    // (or none at all where EGL_KHR_no_config_context is supported)
+    EGLint config_attribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config = EGL_NO_CONFIG_KHR;
+    EGLint configs = 0;
+    eglChooseConfig(display, config_attribs, &config, 1, &configs);
+    if (configs == 0) config = EGL_NO_CONFIG_KHR;
+
+    EGLint context_attribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_CONTEXT_OPENGL_DEBUG, debug ? EGL_TRUE : EGL_FALSE,
+        EGL_NONE,
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, context_attribs);
+    if (context == EGL_NO_CONTEXT) {
+        fprintf(stderr, "failed to create EGL context: 0x%x\n", eglGetError());
+        headless_destroy(headless);
+        return false;
+    }
+    headless->context = context;
+
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        fprintf(stderr, "failed to make surfaceless EGL context current: 0x%x\n", eglGetError());
+        headless_destroy(headless);
+        return false;
+    }
+
+    if (!opengl_load_functions_from(headless_proc)) {
+        headless_destroy(headless);
+        return false;
+    }
+
+    // the framebuffer stands in for the window's default framebuffer
+    glGenFramebuffers(1, &headless->framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, headless->framebuffer);
+
+    glGenRenderbuffers(1, &headless->color);
+    glBindRenderbuffer(GL_RENDERBUFFER, headless->color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, headless->color);
+
+    if (depth) {
+        glGenRenderbuffers(1, &headless->depth);
+        glBindRenderbuffer(GL_RENDERBUFFER, headless->depth);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, headless->depth);
+    }
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        fprintf(stderr, "headless framebuffer is incomplete\n");
+        headless_destroy(headless);
+        return false;
+    }
+
+    return true;
+}
+
+void
+headless_destroy(struct FlappyHeadless* headless)
+{
+    assert(headless != NULL);
+
+    EGLDisplay display = headless->display;
+    if (display == NULL) return;
+
+    if (headless->framebuffer != 0) {
+        glstate_forget();
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &headless->framebuffer);
+        glDeleteRenderbuffers(1, &headless->color);
+        glDeleteRenderbuffers(1, &headless->depth);
+    }
+
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (headless->context != NULL) {
+        eglDestroyContext(display, headless->context);
+    }
+    eglTerminate(display);
+    memset(headless, 0, sizeof(*headless));
+}
+
+void
+headless_read(const struct FlappyHeadless* headless, unsigned char* rgb)
+{
+    assert(headless != NULL);
+    assert(rgb != NULL);
+
+    long width = headless->width;
+    long height = headless->height;
+    long row = width * 3;
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, rgb);
+
+    // GL returns the bottom row first
+    unsigned char* swap = malloc(row);
+    if (swap == NULL) return;
+    for (long y = 0; y < height / 2; y++) {
+        unsigned char* top = rgb + y * row;
+        unsigned char* bottom = rgb + (height - 1 - y) * row;
+        memcpy(swap, top, row);
+        memcpy(top, bottom, row);
+        memcpy(bottom, swap, row);
+    }
+    free(swap);
+}
+
+bool
+headless_write_ppm(const char* path, const unsigned char* rgb, long width, long height)
+{
+    assert(path != NULL);
+    assert(rgb != NULL);
+
+    FILE* fp = fopen(path, "wb");
+    if (fp == NULL) {
+        fprintf(stderr, "failed to open image for writing: %s\n", path);
+        return false;
+    }
+
+    long size = width * height * 3;
+    fprintf(fp, "P6\n%ld %ld\n255\n", width, height);
+    bool ok = fwrite(rgb, 1, size, fp) == (size_t)size;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "failed to write image: %s\n", path);
+    }
+    return ok;
+}
+
+unsigned char*
+headless_read_ppm(const char* path, long* width, long* height)
+{
+    assert(path != NULL);
+    assert(width != NULL);
+    assert(height != NULL);
+
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) {
+        fprintf(stderr, "failed to open image for reading: %s\n", path);
+        return NULL;
+    }
+
+    long max = 0;
+    if (fscanf(fp, "P6 %ld %ld %ld", width, height, &max) != 3 || max != 255 || fgetc(fp) == EOF
+        || *width <= 0 || *height <= 0) {
+        fprintf(stderr, "not an 8-bit binary PPM image: %s\n", path);
+        fclose(fp);
+        return NULL;
+    }
+
+    long size = *width * *height * 3;
+    unsigned char* rgb = malloc(size);
+    if (rgb == NULL || fread(rgb, 1, size, fp) != (size_t)size) {
+        fprintf(stderr, "truncated PPM image: %s\n", path);
+        free(rgb);
+        rgb = NULL;
+    }
+
+    fclose(fp);
+    return rgb;
+}
+
+// compare a frame with a golden image, reporting how far off it is
+bool
+headless_match_ppm(const char* path, const unsigned char* rgb, long width, long height)
+{
+    long golden_width, golden_height;
+    unsigned char* golden = headless_read_ppm(path, &golden_width, &golden_height);
+    if (golden == NULL) return false;
+
+    if (golden_width != width || golden_height != height) {
+        fprintf(stderr, "golden image %s is %ldx%ld, rendered %ldx%ld\n", path, golden_width, golden_height, width, height);
+        free(golden);
+        return false;
+    }
+
+    long size = width * height * 3;
+    long mismatched = 0;
+    int max_diff = 0;
+    for (long i = 0; i < size; i++) {
+        int diff = abs(rgb[i] - golden[i]);
+        if (diff > max_diff) max_diff = diff;
+        if (diff > HEADLESS_TOLERANCE) mismatched++;
+    }
+    free(golden);
+
+    bool match = mismatched <= size * HEADLESS_MISMATCH;
+    printf("golden %s: %ld of %ld channels differ by more than %d (max %d): %s\n",
+        path, mismatched, size, HEADLESS_TOLERANCE, max_diff, match ? "match" : "MISMATCH");
+    return match;
+}
@@ -0,0 +1,39 @@
+#ifndef FLAPPY_HEADLESS_H_INCLUDED
+#define FLAPPY_HEADLESS_H_INCLUDED
+
+#include <stdbool.h>
+
+// Offscreen OpenGL 3.3 core context without a window or display. The
+// context comes from EGL on its surfaceless platform (Mesa llvmpipe runs
+// it on any Linux host, no GPU needed) and draws into a framebuffer
+// object that is bound for the whole lifetime of the context, so
+// game_render works unchanged and headless_read returns what it drew.
+//
+// Users of this module must link with -lEGL.
+
+struct FlappyHeadless {
+    void* display;  // EGLDisplay
+    void* context;  // EGLContext
+    unsigned int framebuffer;
+    unsigned int color;
+    unsigned int depth;
+    long width;
+    long height;
+};
+
+// also loads the OpenGL functions; depth = false leaves out the depth buffer,
+// debug asks for a debug context (more KHR_debug messages, slower)
+bool headless_create(struct FlappyHeadless* headless, long width, long height, bool depth, bool debug);
+void headless_destroy(struct FlappyHeadless* headless);
+
+// rgb receives width * height * 3 bytes, top row first
+void headless_read(const struct FlappyHeadless* headless, unsigned char* rgb);
+
+// binary PPM (P6) images as written by headless_write_ppm, rgb is malloc'd
+bool headless_write_ppm(const char* path, const unsigned char* rgb, long width, long height);
+unsigned char* headless_read_ppm(const char* path, long* width, long* height);
+
+// true when rgb is within a small tolerance of the PPM at path, prints how close
+bool headless_match_ppm(const char* path, const unsigned char* rgb, long width, long height);
+
+#endif
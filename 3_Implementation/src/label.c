@@ -0,0 +1,80 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "font.h"
+#include "glstate.h"
+#include "label.h"
+#include "opengl.h"
+#include "stream.h"
+
+enum {
+    LABEL_GLYPH_SIZE = FONT_GLYPH_FLOATS * sizeof(float),
+    LABEL_STREAM_SIZE = 64 * LABEL_LENGTH * LABEL_GLYPH_SIZE,  // rebuilds before wrapping
+};
+
+bool
+label_create(struct FlappyLabel* label)
+{
+    assert(label != NULL);
+
+    memset(label, 0, sizeof(*label));
+    if (!stream_create(&label->stream, LABEL_STREAM_SIZE, FONT_GLYPH_FLOATS)) {
+        return false;
+    }
+
+    // each character is one instance, the font shader builds its quad
+    glstate_bind_vertex_array(label->stream.vao);
+    glVertexAttribDivisor(0, 1);
+    glstate_bind_vertex_array(0);
+    return true;
+}
+
+void
+label_destroy(struct FlappyLabel* label)
+{
+    assert(label != NULL);
+    stream_destroy(&label->stream);
+}
+
+void
+label_set(struct FlappyLabel* label, const char* text)
+{
+    assert(label != NULL);
+    assert(text != NULL);
+
+    char clipped[LABEL_LENGTH];
+    snprintf(clipped, sizeof(clipped), "%s", text);
+    if (label->rebuilds > 0 && strcmp(clipped, label->text) == 0) return;
+
+    memcpy(label->text, clipped, sizeof(label->text));
+    label->rebuilds++;
+    label->glyphs = 0;
+
+    long size = font_glyphs(clipped) * LABEL_GLYPH_SIZE;
+    if (size == 0) return;
+
+    // the stream never rewrites data the GPU may still be drawing from
+    float* buf = stream_map(&label->stream, size, &label->first);
+    if (buf == NULL) return;
+    font_glyph_print(clipped, buf, size);
+    stream_unmap(&label->stream);
+
+    // instanced attributes ignore the draw's first vertex, so point the
+    // attribute at the new glyphs instead (the stream left its VAO bound)
+    glVertexAttribPointer(0, FONT_GLYPH_FLOATS, GL_FLOAT, GL_FALSE, LABEL_GLYPH_SIZE,
+        (void*)(label->first * LABEL_GLYPH_SIZE));
+    label->glyphs = font_glyphs(clipped);
+}
+
+void
+label_draw(const struct FlappyLabel* label)
+{
+    assert(label != NULL);
+    if (label->glyphs == 0) return;
+
+    glstate_bind_vertex_array(label->stream.vao);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, LABEL_GLYPH_VERTICES, label->glyphs);
+}
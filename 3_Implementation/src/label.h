@@ -0,0 +1,35 @@
+#ifndef FLAPPY_LABEL_H_INCLUDED
+#define FLAPPY_LABEL_H_INCLUDED
+
+#include <stdbool.h>
+
+#include "stream.h"
+
+// Retained text. A label keeps the geometry of its string on the GPU and
+// only tessellates and uploads it again when label_set is given a
+// different string, so drawing an unchanged label costs one draw call.
+// Each character is a single instance that the font shader expands into
+// its lit pixels. Drawing uses whatever font program and uniforms are
+// current.
+
+enum {
+    LABEL_LENGTH = 32,  // longest string, including the terminator
+    LABEL_GLYPH_VERTICES = 6,  // one quad per character
+};
+
+struct FlappyLabel {
+    struct FlappyStream stream;
+    char text[LABEL_LENGTH];
+    long first;
+    long glyphs;
+    long rebuilds;  // times the geometry was regenerated
+};
+
+bool label_create(struct FlappyLabel* label);
+void label_destroy(struct FlappyLabel* label);
+
+// longer strings are cut to LABEL_LENGTH - 1 characters
+void label_set(struct FlappyLabel* label, const char* text);
+void label_draw(const struct FlappyLabel* label);
+
+#endif
@@ -1,8 +1,11 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <assert.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include <GLFW/glfw3.h>
@@ -10,11 +13,17 @@
 
 #include "config.h"
 #include "font.h"
+#include "gldebug.h"
+#include "glstate.h"
+#include "gltrace.h"
+#include "headless.h"
 #include "model.h"
 #include "opengl.h"
+#include "passtimer.h"
 #include "physics.h"
 #include "shader.h"
 #include "texture.h"
+#include "timing.h"
 
 // game resources
 #include "models/sprite.h"
@@ -22,13 +31,190 @@
 #include "shaders/font_vert.h"
 #include "shaders/sprite_frag.h"
 #include "shaders/sprite_vert.h"
-#include "textures/bg.h"
-#include "textures/bird.h"
-#include "textures/pipe_bot.h"
-#include "textures/pipe_top.h"
+#include "textures/sprites.h"
 #include "play.h"
 
+enum {
+    GL_CALLS_SHOWN = 12,      // most expensive GL functions in the per-frame table
+    HEADLESS_RATE = 60,       // frames per simulated second
+};
+
+// what --headless renders and checks
+struct HeadlessRun {
+    long frames;
+    long flap;  // tap every N frames, 0 never
+    long width;
+    long height;
+    const char* snapshot_path;
+    const char* golden_path;
+    double min_fps;
+};
 
+// what --trace captures
+struct TraceRange {
+    const char* path;  // NULL to not trace
+    long first;
+    long count;
+};
+
+// table of the GL functions called since the frame started (empty unless
+// built with -DOPENGL_PROFILE)
+static void
+print_gl_calls(FILE* fp)
+{
+    struct OpenGLCallStats calls[GL_CALLS_SHOWN];
+    long count = opengl_profile_stats(calls, GL_CALLS_SHOWN);
+    if (count == 0) return;
+
+    fprintf(fp, "GL calls this frame:\n");
+    for (long i = 0; i < count; i++) {
+        fprintf(fp, "  %s: %ld calls, %.1f us\n", calls[i].name, calls[i].calls, calls[i].seconds * 1e6);
+    }
+}
+
+// average GPU and CPU time of each render pass since the last call
+static void
+print_passes(struct FlappyPassTimer* timer, FILE* fp)
+{
+    struct FlappyPassStats stats[PASSTIMER_PASSES];
+    long count = passtimer_report(timer, stats);
+    if (count == 0) return;
+
+    passtimer_print(stats, count, fp);
+    if (timer->dropped > 0) {
+        fprintf(fp, "(%ld GPU timings were not ready in time and were dropped)\n", timer->dropped);
+        timer->dropped = 0;
+    }
+}
+
+// start tracing if asked to, true when tracing
+static bool
+start_trace(struct FlappyGLTrace* trace, const struct TraceRange* range, long width, long height, bool depth)
+{
+    if (range->path == NULL) return false;
+    return gltrace_start(trace, range->path, width, height, depth, range->first, range->count);
+}
+
+static void
+finish_trace(struct FlappyGLTrace* trace)
+{
+    if (!gltrace_stop(trace)) return;
+    printf("trace: %ld frames, %ld setup calls, %ld frame calls, %ld bytes written to %s\n",
+        trace->frames, trace->setup_calls, trace->frame_calls, trace->bytes, trace->path);
+}
+
+static double
+wall_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Render a fixed number of frames offscreen with scripted input and a
+// fixed clock, so the result only depends on the seed and options.
+static int
+run_headless(const struct HeadlessRun* run, const struct TraceRange* trace_range, uint32_t seed, double step_rate, const char* record_path, bool painter, bool gl_debug)
+{
+    if (run->frames <= 0) {
+        fprintf(stderr, "headless: --frames must be positive\n");
+        return EXIT_FAILURE;
+    }
+
+    struct FlappyHeadless headless;
+    if (!headless_create(&headless, run->width, run->height, !painter, gl_debug)) {
+        return EXIT_FAILURE;
+    }
+
+    printf("OpenGL Renderer: %s\n", glGetString(GL_RENDERER));
+
+    // before anything is created, so startup compiles and uploads count too
+    struct FlappyGLDebug debug;
+    bool debugging = gl_debug && gldebug_install(&debug);
+
+    // everything from here on can be traced, the framebuffer is already bound
+    struct FlappyGLTrace trace;
+    bool tracing = start_trace(&trace, trace_range, run->width, run->height, !painter);
+
+    glstate_forget();
+    glstate_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glstate_depth_func(GL_LEQUAL);
+
+    struct FlappyBoard game = { 0 };
+    game.painter = painter;
+    if (!start_game(&game, seed)) {
+        headless_destroy(&headless);
+        return EXIT_FAILURE;
+    }
+    game.step = step_rate > 0.0 ? 1.0 / step_rate : 0.0;
+
+    struct FlappyPassTimer timer;
+    if (passtimer_create(&timer)) {
+        game.timer = &timer;
+    }
+
+    struct FlappyRecorder recorder;
+    if (record_path != NULL) {
+        replay_recorder_init(&recorder);
+        game.recorder = &recorder;
+    }
+
+    double delta = 1.0 / HEADLESS_RATE;
+    double start = wall_time();
+    for (long frame = 0; frame < run->frames; frame++) {
+        opengl_profile_reset();
+
+        // a tap holds the key for two frames
+        struct FlappyInput input = { 0 };
+        input.flap = run->flap > 0 && frame % run->flap < 2;
+        input_gme(&game, &input, delta);
+
+        game_render(&game, run->width, run->height, frame * delta);
+        glFinish();
+        if (debugging) gldebug_end_frame(&debug);
+        if (tracing) gltrace_frame(&trace);
+    }
+    double seconds = wall_time() - start;
+    double fps = run->frames / seconds;
+    printf("headless: %ld frames at %ldx%ld in %.3f s, %.1f fps\n", run->frames, run->width, run->height, seconds, fps);
+    print_gl_calls(stdout);
+    if (game.timer != NULL) print_passes(game.timer, stdout);
+    if (debugging) gldebug_print(&debug, stdout);
+    if (tracing) finish_trace(&trace);
+
+    bool ok = true;
+    unsigned char* rgb = malloc(run->width * run->height * 3);
+    if (rgb == NULL) {
+        fprintf(stderr, "failed to allocate frame readback\n");
+        ok = false;
+    } else {
+        headless_read(&headless, rgb);
+        if (run->snapshot_path != NULL) {
+            ok = headless_write_ppm(run->snapshot_path, rgb, run->width, run->height) && ok;
+        }
+        if (run->golden_path != NULL) {
+            ok = headless_match_ppm(run->golden_path, rgb, run->width, run->height) && ok;
+        }
+        free(rgb);
+    }
+
+    if (fps < run->min_fps) {
+        fprintf(stderr, "headless: %.1f fps is below the required %.1f\n", fps, run->min_fps);
+        ok = false;
+    }
+
+    if (record_path != NULL) {
+        replay_finish(&recorder, &game.sim);
+        ok = replay_write(&recorder, record_path) && ok;
+        replay_recorder_free(&recorder);
+    }
+
+    if (game.timer != NULL) passtimer_destroy(game.timer);
+    end_game(&game);
+    if (debugging) gldebug_remove(&debug);
+    headless_destroy(&headless);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
 
 static void
 print_usage(const char* arg0)
@@ -39,6 +225,21 @@ print_usage(const char* arg0)
     printf("  -h --help        print this help\n");
     printf("  -f --fullscreen  fullscreen rootwin\n");
     printf("  -v --vsync       enable vsync\n");
+    printf("  -p --painter     no depth buffer, draw back to front\n");
+    printf("  -d --gl-debug    debug context, count driver warnings per frame (KHR_debug)\n");
+    printf("     --trace FILE  write every GL call of some frames to FILE, for flappy-replay-gl\n");
+    printf("     --trace-frames FIRST:COUNT  frames to trace (default 0:300)\n");
+    printf("  -s --step HZ     fixed simulation rate (default %.0f, 0 = variable)\n", STEP_RATE);
+    printf("     --seed N      level seed (default: current time)\n");
+    printf("  -r --record FILE record every run's inputs to FILE\n");
+    printf("  -t --timing FILE dump per-frame timings to FILE on exit (.json or CSV)\n");
+    printf("     --headless    render offscreen (EGL, no display needed) and exit, with:\n");
+    printf("       --frames N      frames to render (default 600)\n");
+    printf("       --size WxH      framebuffer size (default 1280x720)\n");
+    printf("       --flap N        tap flap every N frames (default 40, 0 = never)\n");
+    printf("       --snapshot FILE write the last frame to FILE (binary PPM)\n");
+    printf("       --golden FILE   fail unless the last frame matches FILE\n");
+    printf("       --min-fps FPS   fail when rendering is slower than FPS\n");
 }
 
 int
@@ -46,6 +247,20 @@ main(int argc, char* argv[])
 {
     bool fullscreen = false;
     bool vsync = false;
+    bool painter = false;
+    bool gl_debug = false;
+    struct TraceRange trace_range = { NULL, 0, 300 };
+    double step_rate = STEP_RATE;
+    uint32_t seed = time(NULL);
+    const char* record_path = NULL;
+    const char* timing_path = NULL;
+    bool headless = false;
+    struct HeadlessRun run = {
+        .frames = 600,
+        .flap = 40,
+        .width = 1280,
+        .height = 720,
+    };
 
     // process CLI args and update corresponding flags
     for (int i = 1; i < argc; i++) {
@@ -59,9 +274,67 @@ main(int argc, char* argv[])
         if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--vsync") == 0) {
             vsync = true;
         }
+        if (strcmp(argv[i], "-p") == 0 || strcmp(argv[i], "--painter") == 0) {
+            painter = true;
+        }
+        if (strcmp(argv[i], "-d") == 0 || strcmp(argv[i], "--gl-debug") == 0) {
+            gl_debug = true;
+        }
+        if ((strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--step") == 0) && i + 1 < argc) {
+            step_rate = atof(argv[++i]);
+        }
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoul(argv[++i], NULL, 10);
+        }
+        if ((strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "--record") == 0) && i + 1 < argc) {
+            record_path = argv[++i];
+        }
+        if ((strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--timing") == 0) && i + 1 < argc) {
+            timing_path = argv[++i];
+        }
+        if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_range.path = argv[++i];
+        }
+        if (strcmp(argv[i], "--trace-frames") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%ld:%ld", &trace_range.first, &trace_range.count) != 2 || trace_range.first < 0 || trace_range.count <= 0) {
+                fprintf(stderr, "invalid trace frames: %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        if (strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        }
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            run.frames = atol(argv[++i]);
+        }
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%ldx%ld", &run.width, &run.height) != 2 || run.width <= 0 || run.height <= 0) {
+                fprintf(stderr, "invalid size: %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        if (strcmp(argv[i], "--flap") == 0 && i + 1 < argc) {
+            run.flap = atol(argv[++i]);
+        }
+        if (strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc) {
+            run.snapshot_path = argv[++i];
+        }
+        if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc) {
+            run.golden_path = argv[++i];
+        }
+        if (strcmp(argv[i], "--min-fps") == 0 && i + 1 < argc) {
+            run.min_fps = atof(argv[++i]);
+        }
     }
 
-    srand(time(NULL));
+    if (record_path != NULL && step_rate <= 0.0) {
+        fprintf(stderr, "recording requires a fixed simulation rate\n");
+        return EXIT_FAILURE;
+    }
+
+    if (headless) {
+        return run_headless(&run, &trace_range, seed, step_rate, record_path, painter, gl_debug);
+    }
 
     if (!glfwInit()) {
         const char* error = NULL;
@@ -85,6 +358,8 @@ main(int argc, char* argv[])
     glfwWindowHint(GLFW_GREEN_BITS, mode->greenBits);
     glfwWindowHint(GLFW_BLUE_BITS, mode->blueBits);
     glfwWindowHint(GLFW_REFRESH_RATE, mode->refreshRate);
+    glfwWindowHint(GLFW_DEPTH_BITS, painter ? 0 : 24);
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, gl_debug ? GLFW_TRUE : GLFW_FALSE);
 
     GLFWwindow* rootwin = NULL;
     if (fullscreen) {
@@ -107,49 +382,116 @@ main(int argc, char* argv[])
     glfwSwapInterval(vsync ? 1 : 0);
     opengl_load_functions();
 
+    // before anything is created, so startup compiles and uploads count too
+    struct FlappyGLDebug debug;
+    bool debugging = gl_debug && gldebug_install(&debug);
+
     printf("OpenGL Vendor:   %s\n", glGetString(GL_VENDOR));
     printf("OpenGL Renderer: %s\n", glGetString(GL_RENDERER));
     printf("OpenGL Version:  %s\n", glGetString(GL_VERSION));
     printf("GLSL Version:    %s\n", glGetString(GL_SHADING_LANGUAGE_VERSION));
 
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    struct FlappyGLTrace trace;
+    int trace_width, trace_height;
+    glfwGetFramebufferSize(rootwin, &trace_width, &trace_height);
+    bool tracing = start_trace(&trace, &trace_range, trace_width, trace_height, !painter);
 
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LEQUAL);
+    // the render queue switches blending and depth testing per pass
+    glstate_forget();
+    glstate_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glstate_depth_func(GL_LEQUAL);
 
     struct FlappyBoard game = { 0 };
-    start_game(&game);
+    game.painter = painter;
+    if (!start_game(&game, seed)) {
+        if (tracing) finish_trace(&trace);
+        if (debugging) gldebug_remove(&debug);
+        glfwDestroyWindow(rootwin);
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    game.step = step_rate > 0.0 ? 1.0 / step_rate : 0.0;
+
+    struct FlappyPassTimer timer;
+    if (passtimer_create(&timer)) {
+        game.timer = &timer;
+    }
+
+    struct FlappyRecorder recorder;
+    if (record_path != NULL) {
+        replay_recorder_init(&recorder);
+        game.recorder = &recorder;
+    }
 
     // timing vars
     double l_sec = glfwGetTime();
     double l_frme = l_sec;
     long num_frame = 0;
 
+    // per-phase frame times (too big for the stack)
+    static struct FlappyTiming timing;
+    timing_init(&timing, l_frme);
+
     // loop til exit or ESCAPE key
     while (!glfwWindowShouldClose(rootwin)) {
+        opengl_profile_reset();
         double now = glfwGetTime();
         double delta = now - l_frme;
         l_frme = now;
 
         change_gme(&game, rootwin, delta);
+        timing_mark(&timing, TIMING_SIM, glfwGetTime());
 
         int width, height;
         glfwGetFramebufferSize(rootwin, &width, &height);
-        game_render(&game, width, height);
+        game_render(&game, width, height, glfwGetTime());
+        timing_mark(&timing, TIMING_RENDER, glfwGetTime());
+
+        glfwSwapBuffers(rootwin);
+        if (tracing) gltrace_frame(&trace);
+        timing_mark(&timing, TIMING_SWAP, glfwGetTime());
+
+        glfwPollEvents();
+        timing_mark(&timing, TIMING_POLL, glfwGetTime());
+        timing_end_frame(&timing);
+        if (debugging) gldebug_end_frame(&debug);
+
+        // state changes of this frame, cleared every frame
+        struct FlappyGLStats gl_stats;
+        glstate_stats(&gl_stats);
+        glstate_stats_reset();
 
         num_frame++;
-        if (glfwGetTime() - l_sec >= 1.0) {
-            printf("FPS: %ld  (%lf ms/frame)\n", num_frame, 1000.0/num_frame);
+        if (now - l_sec >= 1.0) {
+            printf("FPS: %ld  GL state: %ld issued %ld skipped\n", num_frame, gl_stats.issued, gl_stats.skipped);
+            timing_print_recent(&timing, num_frame, stdout);
+            print_gl_calls(stdout);
+            if (game.timer != NULL) print_passes(game.timer, stdout);
+            if (debugging) gldebug_print(&debug, stdout);
             num_frame = 0;
             l_sec += 1.0;
+
+            // printing is not part of the next frame
+            timing_skip(&timing, glfwGetTime());
         }
+    }
 
-        glfwSwapBuffers(rootwin);
-        glfwPollEvents();
+    printf("last %ld frames:\n", timing.count < TIMING_FRAMES ? timing.count : (long)TIMING_FRAMES);
+    timing_print(&timing, stdout);
+    if (timing_path != NULL) {
+        timing_dump(&timing, timing_path);
+    }
+
+    if (record_path != NULL) {
+        replay_finish(&recorder, &game.sim);
+        replay_write(&recorder, record_path);
+        replay_recorder_free(&recorder);
     }
 
+    if (tracing) finish_trace(&trace);
+    if (game.timer != NULL) passtimer_destroy(game.timer);
     end_game(&game);
+    if (debugging) gldebug_remove(&debug);
 
     // Cleanup GLFW3 resources
     glfwDestroyWindow(rootwin);
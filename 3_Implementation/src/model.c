@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "glstate.h"
 #include "model.h"
 #include "opengl.h"
 
@@ -31,9 +32,9 @@ model_buffer_create(int format, long count, const float* vertices)
 
     unsigned int vbo;
     glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glstate_bind_buffer(GL_ARRAY_BUFFER, vbo);
     glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glstate_bind_buffer(GL_ARRAY_BUFFER, 0);
 
     return vbo;
 }
@@ -43,8 +44,8 @@ model_buffer_config(int format, int buffer)
 {
     unsigned int vao;
     glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glstate_bind_vertex_array(vao);
+    glstate_bind_buffer(GL_ARRAY_BUFFER, buffer);
 
     long stride = model_vertex_size(format);
     switch (format) {
@@ -64,7 +65,7 @@ model_buffer_config(int format, int buffer)
     }
 
     // unbind VBO _after_ VAO in order to properly capture state?
-    glBindVertexArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glstate_bind_vertex_array(0);
+    glstate_bind_buffer(GL_ARRAY_BUFFER, 0);
     return vao;
 }
@@ -1,6 +1,10 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #include <GL/glcorearb.h>
 #include <GLFW/glfw3.h>
@@ -22,9 +26,87 @@
 // Define all of the initally-NULL OpenGL functions.
 #define OPENGL_FUNCTION OPENGL_DEFINE
 OPENGL_FUNCTIONS
+OPENGL_DEBUG_FUNCTIONS
 #undef OPENGL_FUNCTION
 
-// Load an OpenGL function via glfwGetProcAddress. Check for errors
+// whether the optional debug functions loaded and can be called
+static bool opengl_debug = false;
+
+#ifdef OPENGL_PROFILE
+
+// Every function is wrapped to count its calls and the time spent in the
+// driver. The wrappers are generated from OPENGL_FUNCTIONS by
+// scripts/glwrap.py into opengl_profile.h.
+static double opengl_profile_clock(void);
+static void opengl_profile_add(long index, double start);
+
+#include "opengl_profile.h"
+
+static struct {
+    long calls;
+    double seconds;
+} opengl_profile[OPENGL_PROFILE_FUNCTIONS];
+
+static double
+opengl_profile_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+opengl_profile_add(long index, double start)
+{
+    opengl_profile[index].calls++;
+    opengl_profile[index].seconds += opengl_profile_clock() - start;
+}
+
+long
+opengl_profile_stats(struct OpenGLCallStats* stats, long capacity)
+{
+    // keep the most expensive functions, sorted by time
+    long count = 0;
+    for (long i = 0; i < OPENGL_PROFILE_FUNCTIONS; i++) {
+        if (opengl_profile[i].calls == 0) continue;
+
+        struct OpenGLCallStats call = {
+            .name = OPENGL_PROFILE_NAMES[i],
+            .calls = opengl_profile[i].calls,
+            .seconds = opengl_profile[i].seconds,
+        };
+        long j = count < capacity ? count++ : capacity;
+        while (j > 0 && stats[j - 1].seconds < call.seconds) {
+            if (j < capacity) stats[j] = stats[j - 1];
+            j--;
+        }
+        if (j < capacity) stats[j] = call;
+    }
+    return count;
+}
+
+void
+opengl_profile_reset(void)
+{
+    memset(opengl_profile, 0, sizeof(opengl_profile));
+}
+
+#else
+
+long
+opengl_profile_stats(struct OpenGLCallStats* stats, long capacity)
+{
+    return 0;
+}
+
+void
+opengl_profile_reset(void)
+{
+}
+
+#endif
+
+// Load an OpenGL function via the given loader. Check for errors
 // and return from the load if something goes wrong. The OpenGL function
 // pointer is assigned to the the definition that was initially NULL.
 //
@@ -32,9 +114,9 @@ OPENGL_FUNCTIONS
 //
 //   becomes
 //
-// glCreateShader = (PFNGLCREATESHADERPROC)glfwGetProcAddress("glCreateShader");
+// glCreateShader = (PFNGLCREATESHADERPROC)loader("glCreateShader");
 #define OPENGL_LOAD(func_name, func_type)  \
-    func_name = (func_type)glfwGetProcAddress(#func_name);
+    func_name = (func_type)loader(#func_name);
 
 // Extra safety step to ensure that all the OpenGL functions were successfully
 // dynamically loaded. If a function failed to load, print and error and
@@ -54,11 +136,43 @@ OPENGL_FUNCTIONS
         return false;                                              \
     }
 
+// KHR_debug is core in OpenGL 4.3 and an extension before that
+static bool
+opengl_detect_debug(void)
+{
+    int major = 0;
+    int minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    if (major > 4 || (major == 4 && minor >= 3)) return true;
+
+    int extensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+    for (int i = 0; i < extensions; i++) {
+        const char* name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        if (name != NULL && strcmp(name, "GL_KHR_debug") == 0) return true;
+    }
+    return false;
+}
+
+bool
+opengl_has_debug(void)
+{
+    return opengl_debug;
+}
+
 bool
 opengl_load_functions(void)
 {
-    // use GLFW3's platform-agnostic loader to pull the "real" addresses
-    //  out by name and assign to the definitions above
+    // use GLFW3's platform-agnostic loader
+    return opengl_load_functions_from(glfwGetProcAddress);
+}
+
+bool
+opengl_load_functions_from(opengl_loader loader)
+{
+    // pull the "real" addresses out by name and assign
+    //  to the definitions above
 
     #define OPENGL_FUNCTION OPENGL_LOAD
     OPENGL_FUNCTIONS
@@ -68,5 +182,17 @@ opengl_load_functions(void)
     OPENGL_FUNCTIONS
     #undef OPENGL_FUNCTION
 
+    // loaders hand out addresses for anything the library knows about,
+    // so only trust the debug functions when the context has them
+    #define OPENGL_FUNCTION OPENGL_LOAD
+    OPENGL_DEBUG_FUNCTIONS
+    #undef OPENGL_FUNCTION
+
+    opengl_debug = opengl_detect_debug() && glDebugMessageCallback != NULL && glDebugMessageControl != NULL;
+
+#ifdef OPENGL_PROFILE
+    opengl_profile_install();
+#endif
+
     return true;
 }
@@ -15,14 +15,22 @@
 // https://en.wikipedia.org/wiki/Dynamic_loading
 #define OPENGL_FUNCTIONS                                                            \
     OPENGL_FUNCTION(glGetString, PFNGLGETSTRINGPROC)                                \
+    OPENGL_FUNCTION(glGetStringi, PFNGLGETSTRINGIPROC)                              \
+    OPENGL_FUNCTION(glGetIntegerv, PFNGLGETINTEGERVPROC)                            \
     OPENGL_FUNCTION(glViewport, PFNGLVIEWPORTPROC)                                  \
     OPENGL_FUNCTION(glClear, PFNGLCLEARPROC)                                        \
     OPENGL_FUNCTION(glClearColor, PFNGLCLEARCOLORPROC)                              \
+    OPENGL_FUNCTION(glFinish, PFNGLFINISHPROC)                                      \
+    OPENGL_FUNCTION(glReadPixels, PFNGLREADPIXELSPROC)                              \
+    OPENGL_FUNCTION(glPixelStorei, PFNGLPIXELSTOREIPROC)                            \
     OPENGL_FUNCTION(glEnable, PFNGLENABLEPROC)                                      \
+    OPENGL_FUNCTION(glDisable, PFNGLDISABLEPROC)                                    \
     OPENGL_FUNCTION(glDepthFunc, PFNGLDEPTHFUNCPROC)                                \
+    OPENGL_FUNCTION(glDepthMask, PFNGLDEPTHMASKPROC)                                \
     OPENGL_FUNCTION(glCullFace, PFNGLCULLFACEPROC)                                  \
     OPENGL_FUNCTION(glBlendFunc, PFNGLBLENDFUNCPROC)                                \
     OPENGL_FUNCTION(glDrawArrays, PFNGLDRAWARRAYSPROC)                              \
+    OPENGL_FUNCTION(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC)            \
     OPENGL_FUNCTION(glCreateShader, PFNGLCREATESHADERPROC)                          \
     OPENGL_FUNCTION(glDeleteShader, PFNGLDELETESHADERPROC)                          \
     OPENGL_FUNCTION(glAttachShader, PFNGLATTACHSHADERPROC)                          \
@@ -40,17 +48,32 @@
     OPENGL_FUNCTION(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC)                \
     OPENGL_FUNCTION(glUniform1i, PFNGLUNIFORM1IPROC)                                \
     OPENGL_FUNCTION(glUniform1f, PFNGLUNIFORM1FPROC)                                \
+    OPENGL_FUNCTION(glUniform2f, PFNGLUNIFORM2FPROC)                                \
     OPENGL_FUNCTION(glUniform3f, PFNGLUNIFORM3FPROC)                                \
+    OPENGL_FUNCTION(glUniform3fv, PFNGLUNIFORM3FVPROC)                              \
     OPENGL_FUNCTION(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC)                  \
     OPENGL_FUNCTION(glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC)              \
+    OPENGL_FUNCTION(glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC)          \
+    OPENGL_FUNCTION(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC)            \
     OPENGL_FUNCTION(glGenBuffers, PFNGLGENBUFFERSPROC)                              \
     OPENGL_FUNCTION(glDeleteBuffers, PFNGLDELETEBUFFERSPROC)                        \
     OPENGL_FUNCTION(glBindBuffer, PFNGLBINDBUFFERPROC)                              \
     OPENGL_FUNCTION(glBufferData, PFNGLBUFFERDATAPROC)                              \
+    OPENGL_FUNCTION(glBufferSubData, PFNGLBUFFERSUBDATAPROC)                        \
+    OPENGL_FUNCTION(glMapBufferRange, PFNGLMAPBUFFERRANGEPROC)                      \
+    OPENGL_FUNCTION(glUnmapBuffer, PFNGLUNMAPBUFFERPROC)                            \
+    OPENGL_FUNCTION(glBindBufferBase, PFNGLBINDBUFFERBASEPROC)                      \
+    OPENGL_FUNCTION(glGenQueries, PFNGLGENQUERIESPROC)                              \
+    OPENGL_FUNCTION(glDeleteQueries, PFNGLDELETEQUERIESPROC)                        \
+    OPENGL_FUNCTION(glBeginQuery, PFNGLBEGINQUERYPROC)                              \
+    OPENGL_FUNCTION(glEndQuery, PFNGLENDQUERYPROC)                                  \
+    OPENGL_FUNCTION(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC)                  \
+    OPENGL_FUNCTION(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC)            \
     OPENGL_FUNCTION(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC)                    \
     OPENGL_FUNCTION(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC)              \
     OPENGL_FUNCTION(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC)                    \
     OPENGL_FUNCTION(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC)            \
+    OPENGL_FUNCTION(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC)            \
     OPENGL_FUNCTION(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC)    \
     OPENGL_FUNCTION(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC)  \
     OPENGL_FUNCTION(glGenTextures, PFNGLGENTEXTURESPROC)                            \
@@ -60,8 +83,24 @@
     OPENGL_FUNCTION(glTexImage2D, PFNGLTEXIMAGE2DPROC)                              \
     OPENGL_FUNCTION(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC)                      \
     OPENGL_FUNCTION(glTexParameteri, PFNGLTEXPARAMETERIPROC)                        \
+    OPENGL_FUNCTION(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC)                    \
+    OPENGL_FUNCTION(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC)              \
+    OPENGL_FUNCTION(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC)                    \
+    OPENGL_FUNCTION(glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC)      \
+    OPENGL_FUNCTION(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC)    \
+    OPENGL_FUNCTION(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC)                  \
+    OPENGL_FUNCTION(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC)            \
+    OPENGL_FUNCTION(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC)                  \
+    OPENGL_FUNCTION(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC)            \
     OPENGL_FUNCTION(glPolygonMode, PFNGLPOLYGONMODEPROC)
 
+// Functions that are only there with KHR_debug (core since OpenGL 4.3).
+// They are loaded but not required, check opengl_has_debug() before
+// calling any of them.
+#define OPENGL_DEBUG_FUNCTIONS                                                      \
+    OPENGL_FUNCTION(glDebugMessageCallback, PFNGLDEBUGMESSAGECALLBACKPROC)          \
+    OPENGL_FUNCTION(glDebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC)
+
 // Declare an OpenGL function. Other translation units that require
 // calling OpenGL functions will link against these declarations.
 //
@@ -78,10 +117,35 @@
 // to nothing afterwards just to be safe.
 #define OPENGL_FUNCTION OPENGL_DECLARE
 OPENGL_FUNCTIONS
+OPENGL_DEBUG_FUNCTIONS
 #undef OPENGL_FUNCTION
 
+// Looks up an OpenGL function by name in the current context
+// (glfwGetProcAddress, eglGetProcAddress, ...).
+typedef void (*opengl_proc)(void);
+typedef opengl_proc (*opengl_loader)(const char* name);
+
 // Call this function after obtaining an OpenGL context
-// to dynamically load the modern functions.
+// to dynamically load the modern functions. The first
+// uses GLFW3's loader, the second any other.
 bool opengl_load_functions(void);
+bool opengl_load_functions_from(opengl_loader loader);
+
+// true when the loaded context has KHR_debug, as an extension or as part
+// of OpenGL 4.3, and OPENGL_DEBUG_FUNCTIONS can be called
+bool opengl_has_debug(void);
+
+// Call counts and time spent in the driver per function. Only collected
+// when built with -DOPENGL_PROFILE, otherwise there are never any.
+struct OpenGLCallStats {
+    const char* name;
+    long calls;
+    double seconds;
+};
+
+// fills stats with up to capacity functions called since the last reset,
+// most time first, and returns how many were filled
+long opengl_profile_stats(struct OpenGLCallStats* stats, long capacity);
+void opengl_profile_reset(void);
 
 #endif
@@ -0,0 +1,134 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "opengl.h"
+#include "passtimer.h"
+
+static double
+passtimer_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+bool
+passtimer_create(struct FlappyPassTimer* timer)
+{
+    assert(timer != NULL);
+
+    memset(timer, 0, sizeof(*timer));
+    timer->current = -1;
+
+    glGenQueries(PASSTIMER_LATENCY * PASSTIMER_PASSES, &timer->queries[0][0]);
+    if (timer->queries[0][0] == 0) {
+        fprintf(stderr, "failed to create timer queries\n");
+        return false;
+    }
+    return true;
+}
+
+void
+passtimer_destroy(struct FlappyPassTimer* timer)
+{
+    assert(timer != NULL);
+    glDeleteQueries(PASSTIMER_LATENCY * PASSTIMER_PASSES, &timer->queries[0][0]);
+}
+
+void
+passtimer_frame(struct FlappyPassTimer* timer)
+{
+    assert(timer != NULL);
+    assert(timer->current < 0);
+
+    timer->slot = (timer->slot + 1) % PASSTIMER_LATENCY;
+
+    for (long pass = 0; pass < PASSTIMER_PASSES; pass++) {
+        if (!timer->issued[timer->slot][pass]) continue;
+        timer->issued[timer->slot][pass] = false;
+
+        unsigned int query = timer->queries[timer->slot][pass];
+        int available = 0;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            timer->dropped++;
+            continue;
+        }
+
+        uint64_t ns = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &ns);
+        timer->gpu_ms[pass] += ns / 1e6;
+        timer->gpu_frames[pass]++;
+    }
+}
+
+void
+passtimer_begin(struct FlappyPassTimer* timer, long pass, const char* name)
+{
+    assert(timer != NULL);
+    assert(pass >= 0 && pass < PASSTIMER_PASSES);
+    assert(timer->current < 0);
+
+    // only one GL_TIME_ELAPSED query can be active, passes don't nest
+    timer->current = pass;
+    timer->names[pass] = name;
+    timer->start = passtimer_clock();
+    glBeginQuery(GL_TIME_ELAPSED, timer->queries[timer->slot][pass]);
+}
+
+void
+passtimer_end(struct FlappyPassTimer* timer)
+{
+    assert(timer != NULL);
+    assert(timer->current >= 0);
+
+    long pass = timer->current;
+    glEndQuery(GL_TIME_ELAPSED);
+    timer->issued[timer->slot][pass] = true;
+    timer->cpu_ms[pass] += (passtimer_clock() - timer->start) * 1e3;
+    timer->cpu_frames[pass]++;
+    timer->current = -1;
+}
+
+long
+passtimer_report(struct FlappyPassTimer* timer, struct FlappyPassStats* stats)
+{
+    assert(timer != NULL);
+    assert(stats != NULL);
+
+    long count = 0;
+    for (long pass = 0; pass < PASSTIMER_PASSES; pass++) {
+        if (timer->cpu_frames[pass] == 0) continue;
+
+        struct FlappyPassStats* s = &stats[count++];
+        s->name = timer->names[pass];
+        s->frames = timer->cpu_frames[pass];
+        s->cpu_ms = timer->cpu_ms[pass] / timer->cpu_frames[pass];
+        s->gpu_ms = timer->gpu_frames[pass] > 0 ? timer->gpu_ms[pass] / timer->gpu_frames[pass] : 0.0;
+    }
+
+    memset(timer->gpu_ms, 0, sizeof(timer->gpu_ms));
+    memset(timer->gpu_frames, 0, sizeof(timer->gpu_frames));
+    memset(timer->cpu_ms, 0, sizeof(timer->cpu_ms));
+    memset(timer->cpu_frames, 0, sizeof(timer->cpu_frames));
+    return count;
+}
+
+void
+passtimer_print(const struct FlappyPassStats* stats, long count, FILE* fp)
+{
+    assert(stats != NULL);
+    assert(fp != NULL);
+
+    fprintf(fp, "%-12s %10s %10s\n", "pass", "gpu ms", "cpu ms");
+    for (long i = 0; i < count; i++) {
+        fprintf(fp, "%-12s %10.3f %10.3f\n", stats[i].name, stats[i].gpu_ms, stats[i].cpu_ms);
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef FLAPPY_PASSTIMER_H_INCLUDED
+#define FLAPPY_PASSTIMER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// GPU and CPU time per render pass. Each pass is bracketed by a
+// GL_TIME_ELAPSED query. Queries live in a ring of PASSTIMER_LATENCY
+// frames and a frame's results are only collected when its slot comes
+// round again, by which time the GPU has long finished them, so reading
+// them back never stalls the CPU. A result that still isn't available
+// then is dropped rather than waited for.
+//
+// The CPU time of a pass is the wall time spent submitting it.
+
+enum {
+    PASSTIMER_PASSES = 8,
+    PASSTIMER_LATENCY = 4,  // frames between issuing a query and reading it
+};
+
+struct FlappyPassStats {
+    const char* name;
+    long frames;     // frames averaged
+    double gpu_ms;
+    double cpu_ms;
+};
+
+struct FlappyPassTimer {
+    unsigned int queries[PASSTIMER_LATENCY][PASSTIMER_PASSES];
+    bool issued[PASSTIMER_LATENCY][PASSTIMER_PASSES];
+    const char* names[PASSTIMER_PASSES];
+    long slot;     // ring slot being recorded
+    long current;  // pass being recorded, -1 between passes
+    double start;  // CPU time the current pass began
+
+    // sums since the last passtimer_report
+    double gpu_ms[PASSTIMER_PASSES];
+    long gpu_frames[PASSTIMER_PASSES];
+    double cpu_ms[PASSTIMER_PASSES];
+    long cpu_frames[PASSTIMER_PASSES];
+    long dropped;  // results that weren't ready in time
+};
+
+bool passtimer_create(struct FlappyPassTimer* timer);
+void passtimer_destroy(struct FlappyPassTimer* timer);
+
+// collect the results of the frame that last used the next slot and move to it
+void passtimer_frame(struct FlappyPassTimer* timer);
+
+// passes are numbered by the caller, each may run once per frame
+void passtimer_begin(struct FlappyPassTimer* timer, long pass, const char* name);
+void passtimer_end(struct FlappyPassTimer* timer);
+
+// averages since the last report for every pass seen, returns how many
+long passtimer_report(struct FlappyPassTimer* timer, struct FlappyPassStats* stats);
+void passtimer_print(const struct FlappyPassStats* stats, long count, FILE* fp);
+
+#endif
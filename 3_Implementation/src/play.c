@@ -8,12 +8,18 @@
 #include <GLFW/glfw3.h>
 #include <linmath/linmath.h>
 
+#include "background.h"
 #include "config.h"
 #include "font.h"
+#include "frame.h"
+#include "glstate.h"
+#include "label.h"
 #include "model.h"
 #include "opengl.h"
 #include "physics.h"
+#include "queue.h"
 #include "shader.h"
+#include "sprites.h"
 #include "texture.h"
 
 // boardstate resources
@@ -23,45 +29,43 @@
 #include "shaders/sprite_frag.h"
 #include "shaders/sprite_vert.h"
 #include "textures/bg.h"
-#include "textures/bird.h"
-#include "textures/pipe_bot.h"
-#include "textures/pipe_top.h"
+#include "textures/sprites.h"
 #include "play.h"
+static float
+lerp(float a, float b, float t)
+{
+	return a + (b - a) * t;
+}
+
 static void
-draw_sprite(struct FlappyBoard* boardstate, unsigned t, float x, float y, float z, float r, float sx, float sy)
+draw_sprite(struct FlappyBoard* boardstate, const struct texture_region* t, float x, float y, float z, float r, float sx, float sy)
 {
-	// bind the shader
-	glUseProgram(boardstate->s_s);
-	
-	// setup model matrix
-	mat4x4 m = {{ 0 }};
-	mat4x4_translate(m, x, y, z);
-	mat4x4_rotate_Z(m, m, r * (M_PI / 180.0));  // convert deg to rad
-	mat4x4_scale_aniso(m, m, sx, sy, 1.0f);
-	glUniformMatrix4fv(boardstate->s_s_uniform_model, 1, GL_FALSE, (const float*)m);
-	
-	// setup projection matrix
-	mat4x4 p = {{ 0 }};
-	mat4x4_identity(p);
-	mat4x4_ortho(p, -(WIDTH / 2.0f), (WIDTH / 2.0f), -(HEIGHT / 2.0f), (HEIGHT / 2.0f), -1.0f, 1.0f);
-	glUniformMatrix4fv(boardstate->s_s_uniform_projection, 1, GL_FALSE, (const float*)p);
-	
-	// bind the texture
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, t);
-	
-	// bind the model
-	glBindVertexArray(boardstate->s_m);
-	
-	// draw the sprite!
-	glDrawArrays(GL_TRIANGLES, 0, boardstate->s_m_vertex_count);
+	// only the trimmed part of the image is drawn, centered where it sits
+	// in the whole sprite, and a rotated one is turned back upright
+	float angle = r * (M_PI / 180.0);  // convert deg to rad
+	float cx = (t->x0 + t->x1 - 1.0f) * 0.5f * sx;
+	float cy = (t->y0 + t->y1 - 1.0f) * 0.5f * sy;
+	float w = (t->x1 - t->x0) * sx;
+	float h = (t->y1 - t->y0) * sy;
+	
+	// queue the sprite, game_render draws them all with sprites_flush
+	struct SpriteInstance sprite = {
+		.x = x + cosf(angle) * cx - sinf(angle) * cy,
+		.y = y + sinf(angle) * cx + cosf(angle) * cy,
+		.z = z,
+		.rotation = t->rotated ? angle - M_PI / 2.0 : angle,
+		.scale_x = t->rotated ? h : w,
+		.scale_y = t->rotated ? w : h,
+		.u0 = t->u0, .v0 = t->v0, .u1 = t->u1, .v1 = t->v1,
+	};
+	sprites_add(&boardstate->sprites, boardstate->t_sprites, &sprite);
 }
 
 static void
-draw_text(struct FlappyBoard* boardstate, const char* str, float x, float y, float z, float sx, float sy)
+draw_label(struct FlappyBoard* boardstate, const struct FlappyLabel* label, float x, float y, float z, float sx, float sy)
 {
 	// bind the shader
-	glUseProgram(boardstate->f_s);
+	glstate_use_program(boardstate->f_s);
 	
 	// setup layer
 	glUniform1f(boardstate->f_s_uniform_layer, z);
@@ -72,45 +76,61 @@ draw_text(struct FlappyBoard* boardstate, const char* str, float x, float y, flo
 	mat4x4_scale_aniso(m, m, sx, sy, 1.0f);
 	glUniformMatrix4fv(boardstate->f_s_uniform_model, 1, GL_FALSE, (const float*)m);
 	
-	// setup projection matrix
-	mat4x4 p = {{ 0 }};
-	mat4x4_identity(p);
-	mat4x4_ortho(p, -(WIDTH / 2.0f), (WIDTH / 2.0f), -(HEIGHT / 2.0f), (HEIGHT / 2.0f), -1.0f, 1.0f);
-	glUniformMatrix4fv(boardstate->f_s_uniform_projection, 1, GL_FALSE, (const float*)p);
-	
-	long vertices = font_vertices(str);
-	
-	long size = font_size(str);
-	float* buf = malloc(size);
-	assert(buf != NULL);
-	
 	// amazing 4x4 bitmap font clarity
-	font_print(str, buf, size);
-	
-	unsigned vao;
-	glGenVertexArrays(1, &vao);
-	glBindVertexArray(vao);
-	
-	unsigned vbo;
-	glGenBuffers(1, &vbo);
-	glBindBuffer(GL_ARRAY_BUFFER, vbo);
-	
-	glBufferData(GL_ARRAY_BUFFER, size, buf, GL_STATIC_DRAW);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (const void*)0);
-	glEnableVertexAttribArray(0);
-	
-	free(buf);
-	
-	glUseProgram(boardstate->f_s);
-	glBindVertexArray(vao);
-	glDrawArrays(GL_TRIANGLES, 0, vertices);
-	
-	glDeleteBuffers(1, &vbo);
-	glDeleteVertexArrays(1, &vao);
+	label_draw(label);
+}
+
+// render passes timed when a pass timer is attached
+enum {
+	PASS_BACKGROUND,
+	PASS_SPRITES,
+	PASS_HUD,
+};
+
+static void
+pass_begin(struct FlappyBoard* boardstate, long pass, const char* name)
+{
+	if (boardstate->timer != NULL) passtimer_begin(boardstate->timer, pass, name);
+}
+
+static void
+pass_end(struct FlappyBoard* boardstate)
+{
+	if (boardstate->timer != NULL) passtimer_end(boardstate->timer);
+}
+
+static void
+render_background(void* data)
+{
+	struct FlappyBoard* boardstate = data;
+	pass_begin(boardstate, PASS_BACKGROUND, "background");
+	background_draw(&boardstate->background, BG_LAYER);
+	pass_end(boardstate);
+}
+
+// pipes and the bird share one instanced draw, so they are one pass
+static void
+render_sprites(void* data)
+{
+	struct FlappyBoard* boardstate = data;
+	pass_begin(boardstate, PASS_SPRITES, "pipes+bird");
+	sprites_flush(&boardstate->sprites);
+	pass_end(boardstate);
 }
 
+static void
+render_score(void* data)
+{
+	struct FlappyBoard* boardstate = data;
+	pass_begin(boardstate, PASS_HUD, "hud");
+	draw_label(boardstate, &boardstate->score_label, -WIDTH / 2.0f + 1.0f, HEIGHT / 2.0f - 1.0f, SCORE_LAYER, 0.5f, 0.5f);
+	pass_end(boardstate);
+}
+
+// the board must start zeroed: on failure end_game deletes what was
+// created so far, the names of the rest are still 0
 bool
-start_game(struct FlappyBoard* boardstate)
+start_game(struct FlappyBoard* boardstate, uint32_t seed)
 {
 	assert(boardstate != NULL);
 	
@@ -118,31 +138,45 @@ start_game(struct FlappyBoard* boardstate)
 	boardstate->f_s = shader_compile_and_link(SHADER_FONT_VERT_SOURCE, SHADER_FONT_FRAG_SOURCE);
 	boardstate->f_s_uniform_layer = glGetUniformLocation(boardstate->f_s, "u_layer");
 	boardstate->f_s_uniform_model = glGetUniformLocation(boardstate->f_s, "u_model");
-	boardstate->f_s_uniform_projection = glGetUniformLocation(boardstate->f_s, "u_projection");
+	frame_program_bind(boardstate->f_s);
 	
-	// create shader for rendering sprites
-	boardstate->s_s = shader_compile_and_link(SHADER_SPRITE_VERT_SOURCE, SHADER_SPRITE_FRAG_SOURCE);
-	boardstate->s_s_uniform_model = glGetUniformLocation(boardstate->s_s, "u_model");
-	boardstate->s_s_uniform_projection = glGetUniformLocation(boardstate->s_s, "u_projection");
+	// score text, rebuilt only when the score changes
+	if (!label_create(&boardstate->score_label)) {
+		end_game(boardstate);
+		return false;
+	}
+	boardstate->score_shown = -1;
 	
-	// set texture uniform location
-	glUseProgram(boardstate->s_s);
-	glUniform1i(glGetUniformLocation(boardstate->s_s, "u_texture"), 0);
-	glUseProgram(0);
+	// create per-frame uniforms shared by all programs
+	boardstate->frame_ubo = frame_buffer_create();
 	
-	// create model for rendering sprites
+	// create model and instanced renderer for sprites
 	boardstate->s_b = model_buffer_create(MODEL_SPRITE_FORMAT, MODEL_SPRITE_VERTEX_COUNT, MODEL_SPRITE_VERTICES);
-	boardstate->s_m = model_buffer_config(MODEL_SPRITE_FORMAT, boardstate->s_b);
 	boardstate->s_m_vertex_count = MODEL_SPRITE_VERTEX_COUNT;
+	if (!sprites_create(&boardstate->sprites, boardstate->s_b, boardstate->s_m_vertex_count)) {
+		end_game(boardstate);
+		return false;
+	}
 	
-	// create textures
+	// create texture atlas
+	boardstate->t_sprites = texture_create(TEXTURE_SPRITES_FORMAT, TEXTURE_SPRITES_WIDTH, TEXTURE_SPRITES_HEIGHT, TEXTURE_SPRITES_PIXELS);
 	boardstate->t_bg = texture_create(TEXTURE_BG_FORMAT, TEXTURE_BG_WIDTH, TEXTURE_BG_HEIGHT, TEXTURE_BG_PIXELS);
-	boardstate->t_bird = texture_create(TEXTURE_BIRD_FORMAT,TEXTURE_BIRD_WIDTH, TEXTURE_BIRD_HEIGHT, TEXTURE_BIRD_PIXELS);
-	boardstate->t_pipebottom = texture_create(TEXTURE_PIPE_BOT_FORMAT, TEXTURE_PIPE_BOT_WIDTH,TEXTURE_PIPE_BOT_HEIGHT, TEXTURE_PIPE_BOT_PIXELS);
-	boardstate->t_pipetop = texture_create(TEXTURE_PIPE_TOP_FORMAT,TEXTURE_PIPE_TOP_WIDTH, TEXTURE_PIPE_TOP_HEIGHT, TEXTURE_PIPE_TOP_PIXELS);
+	
+	// background tiled across the view in one draw
+	struct BackgroundLayer bg = {
+		.texture = boardstate->t_bg,
+		.width = BG_WIDTH, .height = BG_HEIGHT,
+		.rate = 1.0f,
+	};
+	if (!background_create(&boardstate->background, WIDTH, HEIGHT, &bg, 1)) {
+		end_game(boardstate);
+		return false;
+	}
+	
+	queue_init(&boardstate->queue, boardstate->painter);
 	
 	// reset
-	rst_gme(boardstate);
+	rst_gme(boardstate, seed);
 	return true;
 }
 
@@ -151,108 +185,103 @@ end_game(struct FlappyBoard* boardstate)
 {
 	assert(boardstate != NULL);
 	
+	glstate_forget();
 	glDeleteProgram(boardstate->f_s);
-	glDeleteProgram(boardstate->s_s);
+	sprites_destroy(&boardstate->sprites);
+	background_destroy(&boardstate->background);
+	label_destroy(&boardstate->score_label);
+	glDeleteBuffers(1, &boardstate->frame_ubo);
 	glDeleteBuffers(1, &boardstate->s_b);
-	glDeleteVertexArrays(1, &boardstate->s_m);
+	glDeleteTextures(1, &boardstate->t_sprites);
 	glDeleteTextures(1, &boardstate->t_bg);
-	glDeleteTextures(1, &boardstate->t_bird);
-	glDeleteTextures(1, &boardstate->t_pipebottom);
-	glDeleteTextures(1, &boardstate->t_pipetop);
 }
 
 void
-rst_gme(struct FlappyBoard* boardstate)
+rst_gme(struct FlappyBoard* boardstate, uint32_t seed)
 {
 	assert(boardstate != NULL);
+	if (boardstate->recorder != NULL) {
+		replay_finish(boardstate->recorder, &boardstate->sim);
+	}
+	sim_reset(&boardstate->sim, seed);
+	
+	boardstate->accumulator = 0.0;
+	boardstate->alpha = 1.0f;
+	boardstate->prev_camera = boardstate->sim.camera;
+	boardstate->prev_bird_pos_x = boardstate->sim.bird_pos_x;
+	boardstate->prev_bird_pos_y = boardstate->sim.bird_pos_y;
+	boardstate->prev_bird_vel_y = boardstate->sim.bird_vel_y;
+}
+
+static void
+step_sim(struct FlappyBoard* boardstate, const struct FlappyInput* input, double delta)
+{
+	struct FlappySim* sim = &boardstate->sim;
+	
+	boardstate->prev_camera = sim->camera;
+	boardstate->prev_bird_pos_x = sim->bird_pos_x;
+	boardstate->prev_bird_pos_y = sim->bird_pos_y;
+	boardstate->prev_bird_vel_y = sim->bird_vel_y;
 	
-	// boardstate state
-	boardstate->playing = false;
-	boardstate->game_over = false;
-	boardstate->space = false;
-	boardstate->score = 0;
-	
-	// boardstate objects
-	boardstate->camera = -3.0f;
-	boardstate->bird_pos_x = -6.0f;
-	boardstate->bird_pos_y = 0.0f;
-	boardstate->bird_vel_x = SPEED;
-	boardstate->bird_vel_y = 0.0f;
-	for (long i = 0; i < NUMPIPE; i++) {
-		float gap = (float)rand() / (float)RAND_MAX;  // [0.0, 1.0]
-		gap -= 0.5f;  // [-0.5, 0.5]
-		boardstate->pipes[i] = gap * 4.0f;  // [-2.0, 2.0]
+	if (boardstate->recorder != NULL && boardstate->step > 0.0) {
+		replay_record(boardstate->recorder, sim, input->flap, delta);
+	}
+	
+	sim_step(sim, input, delta);
+	
+	// the bird only moves backwards when the sim restarted, don't
+	// interpolate across the jump back to the start
+	if (sim->bird_pos_x < boardstate->prev_bird_pos_x) {
+		boardstate->prev_camera = sim->camera;
+		boardstate->prev_bird_pos_x = sim->bird_pos_x;
+		boardstate->prev_bird_pos_y = sim->bird_pos_y;
+		boardstate->prev_bird_vel_y = sim->bird_vel_y;
 	}
 }
 
 void
 change_gme(struct FlappyBoard* boardstate, GLFWwindow* rootwin, double delta)
 {
-	// can change_gme be detached from the GLFWwindow* ?
 	if (glfwGetKey(rootwin, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
 		glfwSetWindowShouldClose(rootwin, GLFW_TRUE);
 	}
 	
-	// only allow single flaps (not continuous)
-	if (glfwGetKey(rootwin, GLFW_KEY_SPACE) == GLFW_PRESS) {
-		if (boardstate->game_over) rst_gme(boardstate);
-		
-		boardstate->playing = true;
-		if (!boardstate->space) {
-			boardstate->bird_vel_y = FLAP;
-			boardstate->space = true;
-		} else {
-			boardstate->bird_vel_y -= delta * GRAVITY;
-		}
-	} else {
-		if (boardstate->playing) {
-			boardstate->bird_vel_y -= delta * GRAVITY;
-		}
-		boardstate->space = false;
-	}
-	
-	// update bird and camera positions
-	if (boardstate->playing) {
-		boardstate->bird_pos_x += (boardstate->bird_vel_x * delta);
-		boardstate->bird_pos_y += (boardstate->bird_vel_y * delta);
-		boardstate->camera += (boardstate->bird_vel_x * delta);
+	// sample the window's keys and hand them to the headless simulation
+	struct FlappyInput input = { 0 };
+	input.flap = glfwGetKey(rootwin, GLFW_KEY_SPACE) == GLFW_PRESS;
+	input_gme(boardstate, &input, delta);
+}
+
+// advance the game by delta seconds of input from any source (the window,
+// the headless renderer)
+void
+input_gme(struct FlappyBoard* boardstate, const struct FlappyInput* input, double delta)
+{
+	// variable timestep: the sim advances by however long the frame took
+	if (boardstate->step <= 0.0) {
+		step_sim(boardstate, input, delta);
+		boardstate->alpha = 1.0f;
+		return;
 	}
 	
-	// check collision
-	if (boardstate->bird_pos_x >= -4.0f) {
-		// determine index of the next approaching pipe
-		long pipe_index = (boardstate->bird_pos_x + 2.0f) / 4.0f;
-		float gap = boardstate->pipes[pipe_index % NUMPIPE];
-		float top = gap + GAP;
-		float bot = gap - GAP;
-		
-		bool collision = false;
-		if (physics_intersect_circle_rect(boardstate->bird_pos_x, boardstate->bird_pos_y, 0.3f,
-			pipe_index * 4.0f, top, PIPE_WIDTH, PIPE_HEIGHT)) {
-			collision = true;
-			}
-			if (physics_intersect_circle_rect(boardstate->bird_pos_x, boardstate->bird_pos_y, 0.3f,
-				pipe_index * 4.0f, bot, PIPE_WIDTH, PIPE_HEIGHT)) {
-				collision = true;
-				}
-				if (boardstate->bird_pos_y > 4.5f || boardstate->bird_pos_y < -4.5f) {
-					collision = true;
-				}
-				
-				if (collision && !boardstate->game_over) {
-					boardstate->game_over = true;
-					boardstate->bird_vel_x = 0.0f;
-					boardstate->bird_vel_y = 8.0f;
-				}
+	// fixed timestep: run 0..N whole steps and keep the remainder for
+	// the next frame (clamped so a long hitch can't spiral)
+	if (delta > STEP_LIMIT) delta = STEP_LIMIT;
+	boardstate->accumulator += delta;
+	while (boardstate->accumulator >= boardstate->step) {
+		step_sim(boardstate, input, boardstate->step);
+		boardstate->accumulator -= boardstate->step;
 	}
 	
-	// determine score based on bird's position
-	boardstate->score = (boardstate->bird_pos_x + 3.0f) / 4.0f;
+	// how far the render time is between the previous and current step
+	boardstate->alpha = boardstate->accumulator / boardstate->step;
 }
 
 void
-game_render(struct FlappyBoard* boardstate, long width, long height)
+game_render(struct FlappyBoard* boardstate, long width, long height, double time)
 {
+	if (boardstate->timer != NULL) passtimer_frame(boardstate->timer);
+	
 	// determine boxing and calculate centering offsets
 	long x_offset = 0;
 	long y_offset = 0;
@@ -271,40 +300,65 @@ game_render(struct FlappyBoard* boardstate, long width, long height)
 	glViewport(x_offset, y_offset, width, height);
 	
 	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	
-	// draw background (scrolls independently of boardstate objects)
-	double bg_scroll = glfwGetTime() * SCROLL;
-	double bg_offset = fmod(bg_scroll, 4.5);
-	for (float x = -9.0f; x <= 13.5f; x += 4.5f) {
-		draw_sprite(boardstate, boardstate->t_bg,
-					x - bg_offset, 0.0f, BG_LAYER,
-			  0.0f, BG_WIDTH, BG_HEIGHT);
-	}
+	glClear(boardstate->painter ? GL_COLOR_BUFFER_BIT : GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	
+	// background scrolls independently of boardstate objects, each layer
+	// wraps at its own tile width in the shader
+	double bg_scroll = time * SCROLL;
+	
+	// upload everything that is the same for the whole frame once
+	struct FrameUniforms frame = { 0 };
+	mat4x4_ortho((vec4*)frame.projection, -(WIDTH / 2.0f), (WIDTH / 2.0f), -(HEIGHT / 2.0f), (HEIGHT / 2.0f), -1.0f, 1.0f);
+	frame.time = time;
+	frame.scroll = bg_scroll;
+	frame_buffer_update(boardstate->frame_ubo, &frame);
+	
+	// the opaque background goes last among opaque draws, behind the score
+	struct FlappyQueue* queue = &boardstate->queue;
+	queue_submit(queue, QUEUE_OPAQUE, BG_LAYER, boardstate->background.shader, boardstate->t_bg, render_background, boardstate);
+	
+	sprites_begin(&boardstate->sprites);
+	
+	const struct FlappySim* sim = &boardstate->sim;
+	
+	// blend between the last two sim steps by the leftover frame time
+	float alpha = boardstate->alpha;
+	float camera = lerp(boardstate->prev_camera, sim->camera, alpha);
+	float bird_pos_x = lerp(boardstate->prev_bird_pos_x, sim->bird_pos_x, alpha);
+	float bird_pos_y = lerp(boardstate->prev_bird_pos_y, sim->bird_pos_y, alpha);
+	float bird_vel_y = lerp(boardstate->prev_bird_vel_y, sim->bird_vel_y, alpha);
 	
 	// draw pipes (every 4.0f units starting at 0.0f)
-	for (float x = boardstate->camera - 8.0f; x <= boardstate->camera + 12.0f; x += 4.0f) {
+	for (float x = camera - 8.0f; x <= camera + 12.0f; x += 4.0f) {
 		if (x < 0.0f) continue;
 		long pipe_index = x / 4.0f;
-		float gap = boardstate->pipes[pipe_index % NUMPIPE];
+		float gap = sim_pipe(sim, pipe_index);
 		float top = gap + GAP;
 		float bot = gap - GAP;
 		float pipe_x = pipe_index * 4.0f;
-		draw_sprite(boardstate, boardstate->t_pipetop,
-					pipe_x - boardstate->camera, top, PIPE_LAYER,
+		draw_sprite(boardstate, &TEXTURE_SPRITES_PIPE_TOP,
+					pipe_x - camera, top, PIPE_LAYER,
 			  0.0f, PIPE_WIDTH, PIPE_HEIGHT);
-		draw_sprite(boardstate, boardstate->t_pipebottom,
-					pipe_x - boardstate->camera, bot, PIPE_LAYER,
+		draw_sprite(boardstate, &TEXTURE_SPRITES_PIPE_BOT,
+					pipe_x - camera, bot, PIPE_LAYER,
 			  0.0f, PIPE_WIDTH, PIPE_HEIGHT);
 	}
 	
 	// draw bird
-	draw_sprite(boardstate, boardstate->t_bird,
-				boardstate->bird_pos_x - boardstate->camera, boardstate->bird_pos_y, BIRD_LAYER,
-			 boardstate->bird_vel_y * 5.0f, BIRD_WIDTH, BIRD_HEIGHT);
+	draw_sprite(boardstate, &TEXTURE_SPRITES_BIRD,
+				bird_pos_x - camera, bird_pos_y, BIRD_LAYER,
+			 bird_vel_y * 5.0f, BIRD_WIDTH, BIRD_HEIGHT);
+	queue_submit(queue, QUEUE_BLENDED, PIPE_LAYER, boardstate->sprites.shader, boardstate->t_sprites, render_sprites, boardstate);
 	
 	// draw score
-	char score_text[16] = { 0 };
-	snprintf(score_text, 16, "%.3ld", boardstate->score);
-	draw_text(boardstate, score_text, -WIDTH / 2.0f + 1.0f, HEIGHT / 2.0f - 1.0f, 0.5f, 0.5f, 0.5f);
+	if (sim->score != boardstate->score_shown) {
+		char score_text[16] = { 0 };
+		snprintf(score_text, 16, "%.3ld", sim->score);
+		label_set(&boardstate->score_label, score_text);
+		boardstate->score_shown = sim->score;
+	}
+	
+	// the font shader discards unlit pixels, so text is opaque
+	queue_submit(queue, QUEUE_OPAQUE, SCORE_LAYER, boardstate->f_s, 0, render_score, boardstate);
+	queue_flush(queue);
 }
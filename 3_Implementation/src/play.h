@@ -8,12 +8,18 @@
 #include <GLFW/glfw3.h>
 #include <linmath/linmath.h>
 
+#include "background.h"
 #include "config.h"
 #include "font.h"
+#include "frame.h"
+#include "label.h"
 #include "model.h"
 #include "opengl.h"
+#include "passtimer.h"
 #include "physics.h"
+#include "queue.h"
 #include "shader.h"
+#include "sprites.h"
 #include "texture.h"
 
 // game resources
@@ -22,62 +28,73 @@
 #include "shaders/font_vert.h"
 #include "shaders/sprite_frag.h"
 #include "shaders/sprite_vert.h"
-#include "textures/bg.h"
-#include "textures/bird.h"
-#include "textures/pipe_bot.h"
-#include "textures/pipe_top.h"
+#include "textures/sprites.h"
+#include "sim.h"
+#include "replay.h"
 #ifndef M_PI
 #define M_PI 3.141592653589793
 #endif
 
 
-enum {
-	NUMPIPE = 512,
-};
-
 struct FlappyBoard {
 	// shader for font rendering
 	unsigned int f_s;
 	int f_s_uniform_layer;
 	int f_s_uniform_model;
-	int f_s_uniform_projection;
 	
-	// shader for sprite rendering
-	unsigned int s_s;
-	int s_s_uniform_model;
-	int s_s_uniform_projection;
+	// score text and the score it currently shows
+	struct FlappyLabel score_label;
+	long score_shown;
+	
+	// per-frame uniform buffer (projection, time, scroll)
+	unsigned int frame_ubo;
+	
+	// every draw of a frame, sorted by pass, layer and state
+	struct FlappyQueue queue;
+	bool painter;  // no depth buffer, draw strictly back to front
+	
+	// all background layers in one draw
+	struct FlappyBackground background;
+	
+	// instanced sprite rendering
+	struct FlappySprites sprites;
 	unsigned int s_b;
-	unsigned int s_m;
 	unsigned int s_m_vertex_count;
 	
-	// texture handles
+	// texture atlas holding every sprite, the background wraps on its own
+	unsigned int t_sprites;
 	unsigned int t_bg;
-	unsigned int t_bird;
-	unsigned int t_pipebottom;
-	unsigned int t_pipetop;
 	
 	// timing vars
 	double l_sec;
 	double l_frme;
 	long num_frame;
 	
-	// game state
-	bool playing;
-	bool game_over;
-	bool space;
-	long score;
+	// fixed timestep (step <= 0 feeds the raw frame delta to the sim)
+	double step;
+	double accumulator;
+	float alpha;
+	
+	// positions before the last sim step, for interpolated rendering
+	float prev_camera;
+	float prev_bird_pos_x;
+	float prev_bird_pos_y;
+	float prev_bird_vel_y;
+	
+	// simulation state (no GL handles)
+	struct FlappySim sim;
+	
+	// optional input log, only fed in fixed timestep mode
+	struct FlappyRecorder* recorder;
 	
-	// game objects
-	float camera;
-	float bird_pos_x;
-	float bird_pos_y;
-	float bird_vel_x;
-	float bird_vel_y;
-	float pipes[NUMPIPE];
+	// optional GPU/CPU time per render pass
+	struct FlappyPassTimer* timer;
 };
 
-bool start_game(struct FlappyBoard* game);
+bool start_game(struct FlappyBoard* game, uint32_t seed);
 void end_game(struct FlappyBoard* game);
-void rst_gme(struct FlappyBoard* game);
+void rst_gme(struct FlappyBoard* game, uint32_t seed);
 void change_gme(struct FlappyBoard* game, GLFWwindow* window, double delta);
+void input_gme(struct FlappyBoard* game, const struct FlappyInput* input, double delta);
+void game_render(struct FlappyBoard* game, long width, long height, double time);
 void load_game(struct FlappyBoard* game, long width, long height);
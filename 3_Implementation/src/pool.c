@@ -0,0 +1,336 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "pool.h"
+#include "sim.h"
+
+enum {
+    POOL_CHUNK = 64,  // games per unit of work
+    POOL_CACHE_LINE = 64,
+};
+
+struct PoolWorker {
+    struct FlappyPool* pool;
+    pthread_t thread;
+    long index;
+
+    // this worker's chunks are [next, end), other workers steal from it
+    // by bumping the same cursor
+    long next;
+    long end;
+
+    // per-step counters, only touched by the owning thread
+    long steps;
+    long stolen;
+
+    char pad[POOL_CACHE_LINE];
+};
+
+struct FlappyPool {
+    long games;
+    long threads;
+    long frame_skip;
+    long chunks;
+    struct FlappySim* sims;
+    struct PoolWorker* workers;
+
+    // the step being worked on
+    const unsigned char* actions;
+    float* obs;
+    float* reward;
+    unsigned char* done;
+
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t idle;
+    long generation;
+    long running;
+    bool quit;
+
+    // totals for pool_stats
+    long steps;
+    long stolen;
+    double seconds;
+};
+
+static double
+pool_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+pool_observe(const struct FlappySim* sim, float* obs)
+{
+    // same pipe the collision check looks at
+    long pipe_index = (sim->bird_pos_x + 2.0f) / 4.0f;
+    if (pipe_index < 0) pipe_index = 0;
+
+    obs[0] = sim->bird_pos_y;
+    obs[1] = sim->bird_vel_y;
+    obs[2] = pipe_index * 4.0f - sim->bird_pos_x;
+    obs[3] = sim_pipe(sim, pipe_index);
+}
+
+static long
+pool_step_game(struct FlappyPool* pool, long id)
+{
+    struct FlappySim* sim = &pool->sims[id];
+    long score = sim->score;
+    long steps = 0;
+    float reward = 0.0f;
+
+    if (!sim->game_over) {
+        for (long k = 0; k < pool->frame_skip; k++) {
+            struct FlappyInput input = { .flap = pool->actions[id] && k == 0 };
+            sim_step(sim, &input, 1.0 / STEP_RATE);
+            steps++;
+            if (sim->game_over) break;
+        }
+
+        reward = sim->score - score;
+        if (sim->game_over) reward -= 1.0f;
+    }
+
+    pool->reward[id] = reward;
+    pool->done[id] = sim->game_over;
+    pool_observe(sim, pool->obs + id * POOL_OBS);
+    return steps;
+}
+
+static long
+pool_run_chunk(struct FlappyPool* pool, long chunk)
+{
+    long begin = chunk * POOL_CHUNK;
+    long end = begin + POOL_CHUNK;
+    if (end > pool->games) end = pool->games;
+
+    long steps = 0;
+    for (long id = begin; id < end; id++) {
+        steps += pool_step_game(pool, id);
+    }
+    return steps;
+}
+
+static void
+pool_work(struct FlappyPool* pool, struct PoolWorker* self)
+{
+    self->steps = 0;
+    self->stolen = 0;
+
+    // drain our own chunks first
+    for (;;) {
+        long chunk = __atomic_fetch_add(&self->next, 1, __ATOMIC_RELAXED);
+        if (chunk >= self->end) break;
+        self->steps += pool_run_chunk(pool, chunk);
+    }
+
+    // then help whoever still has work left
+    for (long k = 1; k < pool->threads; k++) {
+        struct PoolWorker* victim = &pool->workers[(self->index + k) % pool->threads];
+        for (;;) {
+            long chunk = __atomic_fetch_add(&victim->next, 1, __ATOMIC_RELAXED);
+            if (chunk >= victim->end) break;
+            self->steps += pool_run_chunk(pool, chunk);
+            self->stolen++;
+        }
+    }
+}
+
+static void*
+pool_worker_main(void* arg)
+{
+    struct PoolWorker* self = arg;
+    struct FlappyPool* pool = self->pool;
+    long seen = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == seen && !pool->quit) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->quit) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        pool_work(pool, self);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->running == 0) {
+            pthread_cond_signal(&pool->idle);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+struct FlappyPool*
+pool_create(long games, long threads, long frame_skip)
+{
+    assert(games > 0);
+    assert(frame_skip > 0);
+
+    if (threads <= 0) threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads <= 0) threads = 1;
+
+    struct FlappyPool* pool = calloc(1, sizeof(*pool));
+    if (pool == NULL) {
+        fprintf(stderr, "failed to allocate pool\n");
+        return NULL;
+    }
+
+    pool->games = games;
+    pool->threads = threads;
+    pool->frame_skip = frame_skip;
+    pool->chunks = (games + POOL_CHUNK - 1) / POOL_CHUNK;
+    pool->sims = calloc(games, sizeof(*pool->sims));
+    pool->workers = calloc(threads, sizeof(*pool->workers));
+    if (pool->sims == NULL || pool->workers == NULL) {
+        fprintf(stderr, "failed to allocate pool of %ld games\n", games);
+        free(pool->sims);
+        free(pool->workers);
+        free(pool);
+        return NULL;
+    }
+
+    // game id is the first seed, each reset moves it on by the pool size
+    // so no two episodes in the pool share a level
+    for (long id = 0; id < games; id++) {
+        sim_reset(&pool->sims[id], id);
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    // the calling thread acts as worker 0
+    for (long t = 0; t < threads; t++) {
+        pool->workers[t].pool = pool;
+        pool->workers[t].index = t;
+        if (t == 0) continue;
+
+        if (pthread_create(&pool->workers[t].thread, NULL, pool_worker_main, &pool->workers[t]) != 0) {
+            fprintf(stderr, "failed to create pool thread %ld\n", t);
+            pool->threads = t;
+            break;
+        }
+    }
+
+    return pool;
+}
+
+void
+pool_destroy(struct FlappyPool* pool)
+{
+    if (pool == NULL) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (long t = 1; t < pool->threads; t++) {
+        pthread_join(pool->workers[t].thread, NULL);
+    }
+
+    pthread_cond_destroy(&pool->idle);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool->sims);
+    free(pool);
+}
+
+void
+pool_reset(struct FlappyPool* pool, const long* ids, long count, float* obs)
+{
+    assert(pool != NULL);
+    assert(ids != NULL || count == 0);
+    assert(obs != NULL);
+
+    for (long i = 0; i < count; i++) {
+        long id = ids[i];
+        assert(id >= 0 && id < pool->games);
+
+        sim_reset(&pool->sims[id], pool->sims[id].seed + pool->games);
+        pool_observe(&pool->sims[id], obs + id * POOL_OBS);
+    }
+}
+
+void
+pool_step(struct FlappyPool* pool, const unsigned char* actions, float* obs, float* reward, unsigned char* done)
+{
+    assert(pool != NULL);
+    assert(actions != NULL);
+    assert(obs != NULL);
+    assert(reward != NULL);
+    assert(done != NULL);
+
+    double start = pool_now();
+
+    pthread_mutex_lock(&pool->lock);
+    pool->actions = actions;
+    pool->obs = obs;
+    pool->reward = reward;
+    pool->done = done;
+
+    // hand every worker an equal contiguous run of chunks
+    for (long t = 0; t < pool->threads; t++) {
+        pool->workers[t].next = pool->chunks * t / pool->threads;
+        pool->workers[t].end = pool->chunks * (t + 1) / pool->threads;
+    }
+
+    pool->running = pool->threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    pool_work(pool, &pool->workers[0]);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->running > 0) {
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    for (long t = 0; t < pool->threads; t++) {
+        pool->steps += pool->workers[t].steps;
+        pool->stolen += pool->workers[t].stolen;
+    }
+    pool->seconds += pool_now() - start;
+}
+
+const struct FlappySim*
+pool_game(const struct FlappyPool* pool, long id)
+{
+    assert(pool != NULL);
+    assert(id >= 0 && id < pool->games);
+    return &pool->sims[id];
+}
+
+void
+pool_stats(const struct FlappyPool* pool, struct FlappyPoolStats* stats)
+{
+    assert(pool != NULL);
+    assert(stats != NULL);
+
+    stats->threads = pool->threads;
+    stats->steps = pool->steps;
+    stats->stolen = pool->stolen;
+    stats->seconds = pool->seconds;
+    stats->steps_per_sec = pool->seconds > 0.0 ? pool->steps / pool->seconds : 0.0;
+    stats->steps_per_sec_per_core = stats->steps_per_sec / pool->threads;
+}
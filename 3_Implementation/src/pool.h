@@ -0,0 +1,46 @@
+#ifndef FLAPPY_POOL_H_INCLUDED
+#define FLAPPY_POOL_H_INCLUDED
+
+#include <stdbool.h>
+
+#include "sim.h"
+
+// Vectorized environment: a fixed set of games stepped in parallel by a
+// pool of worker threads. Games are handed out in chunks; a worker that
+// runs out of its own chunks steals from the others, so pools with very
+// uneven episode lengths (dead games cost nothing) still balance.
+//
+// Each pool_step runs frame_skip sim steps per live game at 1 / STEP_RATE.
+// A flap action taps the key on the first of those steps. Finished games
+// stay finished until they are passed to pool_reset.
+//
+// Users of the pool must link with -lpthread.
+
+enum {
+    POOL_OBS = 4,  // bird y, bird y velocity, distance to next pipe, next gap
+};
+
+struct FlappyPoolStats {
+    long threads;
+    long steps;     // sim steps across all games
+    long stolen;    // chunks run by a worker that didn't own them
+    double seconds; // wall time spent inside pool_step
+    double steps_per_sec;
+    double steps_per_sec_per_core;
+};
+
+struct FlappyPool;
+
+struct FlappyPool* pool_create(long games, long threads, long frame_skip);
+void pool_destroy(struct FlappyPool* pool);
+
+// obs has POOL_OBS floats per game, only the reset games are written
+void pool_reset(struct FlappyPool* pool, const long* ids, long count, float* obs);
+
+// actions, reward and done have one entry per game
+void pool_step(struct FlappyPool* pool, const unsigned char* actions, float* obs, float* reward, unsigned char* done);
+
+const struct FlappySim* pool_game(const struct FlappyPool* pool, long id);
+void pool_stats(const struct FlappyPool* pool, struct FlappyPoolStats* stats);
+
+#endif
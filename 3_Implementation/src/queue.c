@@ -0,0 +1,120 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glstate.h"
+#include "opengl.h"
+#include "queue.h"
+
+enum {
+    QUEUE_PASS_SHIFT = 62,
+    QUEUE_LAYER_SHIFT = 46,
+    QUEUE_PROGRAM_SHIFT = 30,
+    QUEUE_TEXTURE_SHIFT = 14,
+};
+
+static const uint64_t QUEUE_FIELD_MASK = 0xffff;
+
+void
+queue_init(struct FlappyQueue* queue, bool painter)
+{
+    assert(queue != NULL);
+
+    memset(queue, 0, sizeof(*queue));
+    queue->painter = painter;
+}
+
+uint64_t
+queue_key(const struct FlappyQueue* queue, int pass, float layer, unsigned int program, unsigned int texture)
+{
+    assert(queue != NULL);
+    assert(pass == QUEUE_OPAQUE || pass == QUEUE_BLENDED);
+
+    if (layer < -1.0f) layer = -1.0f;
+    if (layer > 1.0f) layer = 1.0f;
+    uint64_t depth = (layer + 1.0f) * 0.5f * QUEUE_FIELD_MASK;
+
+    // without a depth buffer everything is one pass in painter's order,
+    // otherwise opaque draws go first and nearest first (larger z is nearer)
+    if (queue->painter) {
+        pass = QUEUE_OPAQUE;
+    } else if (pass == QUEUE_OPAQUE) {
+        depth = QUEUE_FIELD_MASK - depth;
+    }
+
+    return (uint64_t)pass << QUEUE_PASS_SHIFT
+        | depth << QUEUE_LAYER_SHIFT
+        | (program & QUEUE_FIELD_MASK) << QUEUE_PROGRAM_SHIFT
+        | (texture & QUEUE_FIELD_MASK) << QUEUE_TEXTURE_SHIFT;
+}
+
+void
+queue_submit(struct FlappyQueue* queue, int pass, float layer, unsigned int program, unsigned int texture,
+    void (*draw)(void* data), void* data)
+{
+    assert(queue != NULL);
+    assert(draw != NULL);
+
+    if (queue->count == QUEUE_CAPACITY) {
+        queue_flush(queue);
+    }
+
+    // the submission index keeps equal keys in submission order
+    struct QueueCommand* command = &queue->commands[queue->count];
+    command->key = queue_key(queue, pass, layer, program, texture) | queue->count;
+    command->draw = draw;
+    command->data = data;
+    queue->count++;
+}
+
+static int
+queue_compare(const void* a, const void* b)
+{
+    uint64_t ka = ((const struct QueueCommand*)a)->key;
+    uint64_t kb = ((const struct QueueCommand*)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+static void
+queue_pass(const struct FlappyQueue* queue, int pass)
+{
+    if (queue->painter) {
+        glstate_enable(GL_DEPTH_TEST, false);
+        glstate_enable(GL_BLEND, true);
+    } else if (pass == QUEUE_OPAQUE) {
+        glstate_enable(GL_DEPTH_TEST, true);
+        glstate_depth_mask(true);
+        glstate_enable(GL_BLEND, false);
+    } else {
+        glstate_enable(GL_DEPTH_TEST, true);
+        glstate_depth_mask(false);
+        glstate_enable(GL_BLEND, true);
+    }
+}
+
+void
+queue_flush(struct FlappyQueue* queue)
+{
+    assert(queue != NULL);
+    if (queue->count == 0) return;
+
+    qsort(queue->commands, queue->count, sizeof(queue->commands[0]), queue_compare);
+
+    int pass = -1;
+    for (long i = 0; i < queue->count; i++) {
+        const struct QueueCommand* command = &queue->commands[i];
+        int next = command->key >> QUEUE_PASS_SHIFT;
+        if (next != pass) {
+            queue_pass(queue, next);
+            pass = next;
+        }
+        command->draw(command->data);
+    }
+
+    // leave depth writes on so glClear reaches the depth buffer
+    if (!queue->painter) glstate_depth_mask(true);
+    queue->count = 0;
+}
@@ -0,0 +1,47 @@
+#ifndef FLAPPY_QUEUE_H_INCLUDED
+#define FLAPPY_QUEUE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Render queue. Draws are submitted with the pass, layer, program and
+// texture they use and run in sort-key order by queue_flush:
+//
+//   63..62 pass, 61..46 layer, 45..30 program, 29..14 texture, 13..0 submission
+//
+// Opaque draws run first, front to back, so the depth test rejects what
+// they hide before it is shaded. Blended draws follow back to front with
+// depth writes off. In painter mode there is no depth buffer at all and
+// every draw runs back to front by layer.
+//
+// Layers are the z of the ortho projection, from -1.0 (back) to 1.0.
+
+enum {
+    QUEUE_CAPACITY = 64,  // draws per flush (fits the 14 submission bits), more flush early
+};
+
+enum {
+    QUEUE_OPAQUE = 0,
+    QUEUE_BLENDED,
+};
+
+struct QueueCommand {
+    uint64_t key;
+    void (*draw)(void* data);
+    void* data;
+};
+
+struct FlappyQueue {
+    bool painter;
+    long count;
+    struct QueueCommand commands[QUEUE_CAPACITY];
+};
+
+void queue_init(struct FlappyQueue* queue, bool painter);
+
+uint64_t queue_key(const struct FlappyQueue* queue, int pass, float layer, unsigned int program, unsigned int texture);
+void queue_submit(struct FlappyQueue* queue, int pass, float layer, unsigned int program, unsigned int texture,
+    void (*draw)(void* data), void* data);
+void queue_flush(struct FlappyQueue* queue);
+
+#endif
@@ -0,0 +1,213 @@
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "replay.h"
+#include "sim.h"
+
+static const unsigned char REPLAY_MAGIC[] = { 'F', 'L', 'P', 'R', 2 };
+
+static void
+replay_push(unsigned char** buf, long* size, long* capacity, unsigned char byte)
+{
+    if (*size == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 256;
+        *buf = realloc(*buf, *capacity);
+        assert(*buf != NULL);
+    }
+    (*buf)[(*size)++] = byte;
+}
+
+// unsigned LEB128: 7 bits per byte, high bit set on all but the last
+static void
+replay_push_varint(unsigned char** buf, long* size, long* capacity, uint64_t value)
+{
+    while (value >= 0x80) {
+        replay_push(buf, size, capacity, (value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    replay_push(buf, size, capacity, value);
+}
+
+static bool
+replay_read_varint(const unsigned char* data, long size, long* pos, uint64_t* value)
+{
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (*pos >= size) return false;
+
+        unsigned char byte = data[(*pos)++];
+        *value |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+void
+replay_recorder_init(struct FlappyRecorder* rec)
+{
+    assert(rec != NULL);
+
+    memset(rec, 0, sizeof(*rec));
+    for (size_t i = 0; i < sizeof(REPLAY_MAGIC); i++) {
+        replay_push(&rec->data, &rec->size, &rec->capacity, REPLAY_MAGIC[i]);
+    }
+}
+
+void
+replay_recorder_free(struct FlappyRecorder* rec)
+{
+    assert(rec != NULL);
+
+    free(rec->data);
+    free(rec->runs);
+    memset(rec, 0, sizeof(*rec));
+}
+
+static void
+replay_begin(struct FlappyRecorder* rec, uint32_t seed, double step)
+{
+    rec->active = true;
+    rec->seed = seed;
+    rec->step = step;
+    rec->frames = 0;
+    rec->flap = false;
+    rec->length = 0;
+    rec->runs_size = 0;
+}
+
+void
+replay_record(struct FlappyRecorder* rec, const struct FlappySim* sim, bool flap, double step)
+{
+    assert(rec != NULL);
+    assert(sim != NULL);
+    assert(step > 0.0);
+
+    if (!rec->active) {
+        replay_begin(rec, sim->seed, step);
+    } else if (flap && sim->game_over) {
+        // this step restarts the sim on the next level
+        replay_finish(rec, sim);
+        replay_begin(rec, sim->seed + 1, step);
+    }
+
+    if (flap != rec->flap) {
+        replay_push_varint(&rec->runs, &rec->runs_size, &rec->runs_capacity, rec->length);
+        rec->flap = flap;
+        rec->length = 0;
+    }
+    rec->length++;
+    rec->frames++;
+}
+
+void
+replay_finish(struct FlappyRecorder* rec, const struct FlappySim* sim)
+{
+    assert(rec != NULL);
+    assert(sim != NULL);
+
+    if (!rec->active) return;
+    rec->active = false;
+    if (rec->frames == 0) return;
+
+    replay_push_varint(&rec->runs, &rec->runs_size, &rec->runs_capacity, rec->length);
+
+    // sim_step only sees the step as a float, so its bits replay it exactly
+    uint32_t step_bits;
+    memcpy(&step_bits, &rec->step, sizeof(step_bits));
+
+    replay_push_varint(&rec->data, &rec->size, &rec->capacity, rec->seed);
+    replay_push_varint(&rec->data, &rec->size, &rec->capacity, step_bits);
+    replay_push_varint(&rec->data, &rec->size, &rec->capacity, sim->score);
+    replay_push_varint(&rec->data, &rec->size, &rec->capacity, rec->frames);
+    for (long i = 0; i < rec->runs_size; i++) {
+        replay_push(&rec->data, &rec->size, &rec->capacity, rec->runs[i]);
+    }
+}
+
+bool
+replay_write(const struct FlappyRecorder* rec, const char* path)
+{
+    assert(rec != NULL);
+    assert(path != NULL);
+
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "failed to open replay file: %s\n", path);
+        return false;
+    }
+
+    bool ok = fwrite(rec->data, 1, rec->size, f) == (size_t)rec->size;
+    ok = fclose(f) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "failed to write replay file: %s\n", path);
+    }
+    return ok;
+}
+
+bool
+replay_play(const unsigned char* data, long size, struct FlappyReplayStats* stats)
+{
+    assert(data != NULL);
+    assert(stats != NULL);
+
+    memset(stats, 0, sizeof(*stats));
+    if (size < (long)sizeof(REPLAY_MAGIC) || memcmp(data, REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) != 0) {
+        fprintf(stderr, "invalid replay header\n");
+        return false;
+    }
+
+    long pos = sizeof(REPLAY_MAGIC);
+    while (pos < size) {
+        uint64_t seed, step_bits, score, frames;
+        if (!replay_read_varint(data, size, &pos, &seed) ||
+            !replay_read_varint(data, size, &pos, &step_bits) ||
+            !replay_read_varint(data, size, &pos, &score) ||
+            !replay_read_varint(data, size, &pos, &frames)) {
+            fprintf(stderr, "truncated replay run at byte %ld\n", pos);
+            return false;
+        }
+
+        // anything the recorder can't have written would at best take
+        // forever to play, so it is rejected before stepping
+        uint32_t bits = step_bits;
+        float step;
+        memcpy(&step, &bits, sizeof(step));
+        if (seed > UINT32_MAX || step_bits > UINT32_MAX || !isfinite(step) || !(step > 0.0f) ||
+            frames > REPLAY_MAX_STEPS) {
+            fprintf(stderr, "corrupt replay run at byte %ld\n", pos);
+            return false;
+        }
+
+        struct FlappySim sim;
+        sim_reset(&sim, seed);
+
+        struct FlappyInput input = { .flap = false };
+        uint64_t played = 0;
+        while (played < frames) {
+            uint64_t length;
+            if (!replay_read_varint(data, size, &pos, &length) || length > frames - played) {
+                fprintf(stderr, "truncated replay run at byte %ld\n", pos);
+                return false;
+            }
+
+            for (uint64_t i = 0; i < length; i++) {
+                sim_step(&sim, &input, step);
+            }
+            played += length;
+            input.flap = !input.flap;
+        }
+
+        stats->runs++;
+        stats->frames += frames;
+        if ((uint64_t)sim.score != score) {
+            stats->mismatches++;
+        }
+    }
+
+    return true;
+}
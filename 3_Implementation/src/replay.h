@@ -0,0 +1,60 @@
+#ifndef FLAPPY_REPLAY_H_INCLUDED
+#define FLAPPY_REPLAY_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sim.h"
+
+// Compact input logs for fixed timestep runs. A run lasts from a reset
+// until the next one and is stored as varints:
+//
+//   seed, step (bits of the float seconds sim_step integrates with),
+//   final score, step count,
+//   run lengths of the flap key (released first, then held, then released...)
+//
+// The run lengths add up to the step count. A run is about 15 bytes plus
+// two per flap. Since the sim is deterministic, re-simulating a run with
+// the same inputs must reproduce the recorded score. Players reject runs
+// of more than REPLAY_MAX_STEPS steps (weeks of play) as corrupt.
+
+enum {
+    REPLAY_MAX_STEPS = 1 << 28,
+};
+
+struct FlappyRecorder {
+    // finished runs
+    unsigned char* data;
+    long size;
+    long capacity;
+
+    // run being recorded
+    bool active;
+    uint32_t seed;
+    float step;
+    long frames;
+    bool flap;
+    long length;
+    unsigned char* runs;
+    long runs_size;
+    long runs_capacity;
+};
+
+struct FlappyReplayStats {
+    long runs;
+    long frames;
+    long mismatches;  // runs whose re-simulated score differs from the log
+};
+
+void replay_recorder_init(struct FlappyRecorder* rec);
+void replay_recorder_free(struct FlappyRecorder* rec);
+
+// call before every sim_step, with the state the step will start from
+void replay_record(struct FlappyRecorder* rec, const struct FlappySim* sim, bool flap, double step);
+// close the current run (on exit, or before an external reset)
+void replay_finish(struct FlappyRecorder* rec, const struct FlappySim* sim);
+
+bool replay_write(const struct FlappyRecorder* rec, const char* path);
+bool replay_play(const unsigned char* data, long size, struct FlappyReplayStats* stats);
+
+#endif
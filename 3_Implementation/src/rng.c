@@ -0,0 +1,30 @@
+#include <stdint.h>
+
+#include "rng.h"
+
+// Based on:
+// https://nullprogram.com/blog/2018/07/31/ (lowbias32)
+uint32_t
+rng_mix(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= RNG_MIX_1;
+    x ^= x >> 15;
+    x *= RNG_MIX_2;
+    x ^= x >> 16;
+    return x;
+}
+
+uint32_t
+rng_hash(uint32_t seed, uint32_t counter)
+{
+    // the seed picks a starting point, the counter walks a Weyl sequence
+    return rng_mix(rng_mix(seed) + (counter + 1) * RNG_GAMMA);
+}
+
+float
+rng_unit(uint32_t seed, uint32_t counter)
+{
+    // top 24 bits fit a float exactly: [0.0, 1.0)
+    return (float)(rng_hash(seed, counter) >> 8) * (1.0f / 16777216.0f);
+}
@@ -0,0 +1,19 @@
+#ifndef FLAPPY_RNG_H_INCLUDED
+#define FLAPPY_RNG_H_INCLUDED
+
+#include <stdint.h>
+
+// Counter-based random numbers (SplitMix style). Every value is a pure
+// function of (seed, counter): no hidden state, safe to call from any
+// thread, and identical on every machine. Only 32-bit multiplies are
+// used so the same sequence can be computed 8 lanes at a time with AVX2.
+
+static const uint32_t RNG_GAMMA = 0x9e3779b9u;
+static const uint32_t RNG_MIX_1 = 0x7feb352du;
+static const uint32_t RNG_MIX_2 = 0x846ca68bu;
+
+uint32_t rng_mix(uint32_t x);
+uint32_t rng_hash(uint32_t seed, uint32_t counter);
+float rng_unit(uint32_t seed, uint32_t counter);
+
+#endif
@@ -0,0 +1,178 @@
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "config.h"
+#include "physics.h"
+#include "rng.h"
+#include "sim.h"
+
+float
+sim_gap(uint32_t seed, long index)
+{
+    float gap = rng_unit(seed, index);  // [0.0, 1.0)
+    gap -= 0.5f;  // [-0.5, 0.5)
+    return gap * 4.0f;  // [-2.0, 2.0)
+}
+
+float
+sim_pipe(const struct FlappySim* sim, long index)
+{
+    assert(sim != NULL);
+
+    if (index >= sim->pipe_base && index < sim->pipe_base + PIPE_WINDOW) {
+        return sim->pipes[index % PIPE_WINDOW];
+    }
+    return sim_gap(sim->seed, index);
+}
+
+static void
+sim_refill_pipes(struct FlappySim* sim)
+{
+    // keep every pipe that can be on screen (camera - 8.0f and up)
+    long first = floorf((sim->camera - 8.0f) / 4.0f);
+    if (first < 0) first = 0;
+
+    // far jumps regenerate the whole window rather than stepping through
+    if (first - sim->pipe_base > PIPE_WINDOW) sim->pipe_base = first - PIPE_WINDOW;
+
+    while (sim->pipe_base < first) {
+        long index = sim->pipe_base + PIPE_WINDOW;
+        sim->pipes[index % PIPE_WINDOW] = sim_gap(sim->seed, index);
+        sim->pipe_base++;
+    }
+}
+
+void
+sim_reset(struct FlappySim* sim, uint32_t seed)
+{
+    assert(sim != NULL);
+
+    // game state
+    sim->seed = seed;
+    sim->playing = false;
+    sim->game_over = false;
+    sim->space = false;
+    sim->score = 0;
+
+    // game objects
+    sim->camera = -3.0f;
+    sim->bird_pos_x = -6.0f;
+    sim->bird_pos_y = 0.0f;
+    sim->bird_vel_x = SPEED;
+    sim->bird_vel_y = 0.0f;
+    sim->pipe_base = 0;
+    for (long i = 0; i < PIPE_WINDOW; i++) {
+        sim->pipes[i] = sim_gap(seed, i);
+    }
+}
+
+void
+sim_step(struct FlappySim* sim, const struct FlappyInput* input, double delta)
+{
+    assert(sim != NULL);
+    assert(input != NULL);
+
+    // integrate in single precision so batched SIMD kernels match exactly
+    float dt = (float)delta;
+
+    // only allow single flaps (not continuous)
+    if (input->flap) {
+        if (sim->game_over) sim_reset(sim, sim->seed + 1);
+
+        sim->playing = true;
+        if (!sim->space) {
+            sim->bird_vel_y = FLAP;
+            sim->space = true;
+        } else {
+            sim->bird_vel_y -= dt * GRAVITY;
+        }
+    } else {
+        if (sim->playing) {
+            sim->bird_vel_y -= dt * GRAVITY;
+        }
+        sim->space = false;
+    }
+
+    // update bird and camera positions
+    if (sim->playing) {
+        sim->bird_pos_x += (sim->bird_vel_x * dt);
+        sim->bird_pos_y += (sim->bird_vel_y * dt);
+        sim->camera += (sim->bird_vel_x * dt);
+    }
+
+    // check collision
+    if (sim->bird_pos_x >= -4.0f) {
+        // determine index of the next approaching pipe
+        long pipe_index = (sim->bird_pos_x + 2.0f) / 4.0f;
+        float gap = sim_pipe(sim, pipe_index);
+        float top = gap + GAP;
+        float bot = gap - GAP;
+
+        bool collision = false;
+        if (physics_intersect_circle_rect(sim->bird_pos_x, sim->bird_pos_y, 0.3f,
+            pipe_index * 4.0f, top, PIPE_WIDTH, PIPE_HEIGHT)) {
+            collision = true;
+        }
+        if (physics_intersect_circle_rect(sim->bird_pos_x, sim->bird_pos_y, 0.3f,
+            pipe_index * 4.0f, bot, PIPE_WIDTH, PIPE_HEIGHT)) {
+            collision = true;
+        }
+        if (sim->bird_pos_y > 4.5f || sim->bird_pos_y < -4.5f) {
+            collision = true;
+        }
+
+        if (collision && !sim->game_over) {
+            sim->game_over = true;
+            sim->bird_vel_x = 0.0f;
+            sim->bird_vel_y = 8.0f;
+        }
+    }
+
+    // determine score based on bird's position
+    sim->score = (sim->bird_pos_x + 3.0f) / 4.0f;
+
+    sim_refill_pipes(sim);
+}
+
+void
+flappy_snapshot(const struct FlappySim* sim, struct FlappySnapshot* snap)
+{
+    assert(sim != NULL);
+    assert(snap != NULL);
+
+    snap->seed = sim->seed;
+    snap->flags = (sim->playing ? SNAPSHOT_PLAYING : 0) |
+                  (sim->game_over ? SNAPSHOT_GAME_OVER : 0) |
+                  (sim->space ? SNAPSHOT_SPACE : 0);
+    snap->score = sim->score;
+    snap->camera = sim->camera;
+    snap->bird_pos_x = sim->bird_pos_x;
+    snap->bird_pos_y = sim->bird_pos_y;
+    snap->bird_vel_x = sim->bird_vel_x;
+    snap->bird_vel_y = sim->bird_vel_y;
+}
+
+void
+flappy_restore(struct FlappySim* sim, const struct FlappySnapshot* snap)
+{
+    assert(sim != NULL);
+    assert(snap != NULL);
+
+    sim->seed = snap->seed;
+    sim->playing = snap->flags & SNAPSHOT_PLAYING;
+    sim->game_over = snap->flags & SNAPSHOT_GAME_OVER;
+    sim->space = snap->flags & SNAPSHOT_SPACE;
+    sim->score = snap->score;
+    sim->camera = snap->camera;
+    sim->bird_pos_x = snap->bird_pos_x;
+    sim->bird_pos_y = snap->bird_pos_y;
+    sim->bird_vel_x = snap->bird_vel_x;
+    sim->bird_vel_y = snap->bird_vel_y;
+
+    // leave the pipe ring empty: sim_pipe falls back to sim_gap and the
+    // next step refills the whole window, so restoring stays O(1)
+    sim->pipe_base = -PIPE_WINDOW - 1;
+}
@@ -0,0 +1,70 @@
+#ifndef FLAPPY_SIM_H_INCLUDED
+#define FLAPPY_SIM_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Headless game simulation. Nothing in here knows about GLFW or OpenGL:
+// callers sample their own input into a FlappyInput and step the state.
+//
+// Levels come from a seed: pipe gap i of seed s is always sim_gap(s, i).
+// Flapping after a game over restarts on the next level (seed + 1).
+// Levels are endless: only the pipes near the camera are kept, in a small
+// ring that is refilled as the camera moves forward.
+
+enum {
+    PIPE_WINDOW = 8,  // pipes kept materialized around the camera
+};
+
+struct FlappyInput {
+    bool flap;  // flap key is currently held down
+};
+
+struct FlappySim {
+    // game state
+    uint32_t seed;
+    bool playing;
+    bool game_over;
+    bool space;
+    long score;
+
+    // game objects
+    float camera;
+    float bird_pos_x;
+    float bird_pos_y;
+    float bird_vel_x;
+    float bird_vel_y;
+
+    // gaps of pipes [pipe_base, pipe_base + PIPE_WINDOW), indexed modulo
+    long pipe_base;
+    float pipes[PIPE_WINDOW];
+};
+
+// Minimal trivially-copyable copy of a FlappySim for tree search and
+// rollback. Pipes are not stored: they are regenerated from the seed.
+struct FlappySnapshot {
+    uint32_t seed;
+    uint32_t flags;  // SNAPSHOT_* bits
+    int32_t score;
+    float camera;
+    float bird_pos_x;
+    float bird_pos_y;
+    float bird_vel_x;
+    float bird_vel_y;
+};
+
+enum {
+    SNAPSHOT_PLAYING = 1 << 0,
+    SNAPSHOT_GAME_OVER = 1 << 1,
+    SNAPSHOT_SPACE = 1 << 2,
+};
+
+float sim_gap(uint32_t seed, long index);
+float sim_pipe(const struct FlappySim* sim, long index);
+void sim_reset(struct FlappySim* sim, uint32_t seed);
+void sim_step(struct FlappySim* sim, const struct FlappyInput* input, double delta);
+
+void flappy_snapshot(const struct FlappySim* sim, struct FlappySnapshot* snap);
+void flappy_restore(struct FlappySim* sim, const struct FlappySnapshot* snap);
+
+#endif
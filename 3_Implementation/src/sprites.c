@@ -0,0 +1,175 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "frame.h"
+#include "glstate.h"
+#include "model.h"
+#include "opengl.h"
+#include "shader.h"
+#include "sprites.h"
+
+#include "shaders/sprite_frag.h"
+#include "shaders/sprite_vert.h"
+
+enum {
+    SPRITES_ATTRIB_OFFSET = 2,
+    SPRITES_ATTRIB_TRANSFORM = 3,
+    SPRITES_ATTRIB_REGION = 4,
+};
+
+// point the per-instance attributes at the instance starting at base
+static void
+sprites_attribs(long base)
+{
+    long stride = sizeof(struct SpriteInstance);
+    long start = base * stride;
+
+    glVertexAttribPointer(SPRITES_ATTRIB_OFFSET, 3, GL_FLOAT, GL_FALSE, stride,
+        (void*)(start + offsetof(struct SpriteInstance, x)));
+    glVertexAttribPointer(SPRITES_ATTRIB_TRANSFORM, 3, GL_FLOAT, GL_FALSE, stride,
+        (void*)(start + offsetof(struct SpriteInstance, rotation)));
+    glVertexAttribPointer(SPRITES_ATTRIB_REGION, 4, GL_FLOAT, GL_FALSE, stride,
+        (void*)(start + offsetof(struct SpriteInstance, u0)));
+}
+
+bool
+sprites_create(struct FlappySprites* sprites, unsigned int model_buffer, long vertex_count)
+{
+    assert(sprites != NULL);
+
+    memset(sprites, 0, sizeof(*sprites));
+    sprites->vertex_count = vertex_count;
+
+    sprites->shader = shader_compile_and_link(SHADER_SPRITE_VERT_SOURCE, SHADER_SPRITE_FRAG_SOURCE);
+    if (sprites->shader == 0) {
+        fprintf(stderr, "failed to create sprite shader\n");
+        return false;
+    }
+    frame_program_bind(sprites->shader);
+
+    glstate_use_program(sprites->shader);
+    glUniform1i(glGetUniformLocation(sprites->shader, "u_texture"), 0);
+    glstate_use_program(0);
+
+    // per vertex attributes come from the shared quad model
+    sprites->vao = model_buffer_config(MODEL_FORMAT_T2F_V3F, model_buffer);
+
+    glGenBuffers(1, &sprites->instance_buffer);
+    glstate_bind_vertex_array(sprites->vao);
+    glstate_bind_buffer(GL_ARRAY_BUFFER, sprites->instance_buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(sprites->sorted), NULL, GL_STREAM_DRAW);
+
+    sprites_attribs(0);
+    glEnableVertexAttribArray(SPRITES_ATTRIB_OFFSET);
+    glEnableVertexAttribArray(SPRITES_ATTRIB_TRANSFORM);
+    glEnableVertexAttribArray(SPRITES_ATTRIB_REGION);
+    glVertexAttribDivisor(SPRITES_ATTRIB_OFFSET, 1);
+    glVertexAttribDivisor(SPRITES_ATTRIB_TRANSFORM, 1);
+    glVertexAttribDivisor(SPRITES_ATTRIB_REGION, 1);
+
+    glstate_bind_vertex_array(0);
+    glstate_bind_buffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void
+sprites_destroy(struct FlappySprites* sprites)
+{
+    assert(sprites != NULL);
+
+    glstate_forget();
+    glDeleteProgram(sprites->shader);
+    glDeleteBuffers(1, &sprites->instance_buffer);
+    glDeleteVertexArrays(1, &sprites->vao);
+}
+
+void
+sprites_begin(struct FlappySprites* sprites)
+{
+    assert(sprites != NULL);
+
+    sprites->count = 0;
+    sprites->groups = 0;
+}
+
+void
+sprites_add(struct FlappySprites* sprites, unsigned int texture, const struct SpriteInstance* sprite)
+{
+    assert(sprites != NULL);
+    assert(sprite != NULL);
+
+    long g = 0;
+    while (g < sprites->groups && sprites->textures[g] != texture) g++;
+
+    if (sprites->count == SPRITES_CAPACITY || g == SPRITES_TEXTURES) {
+        sprites_flush(sprites);
+        g = 0;
+    }
+    if (g == sprites->groups) {
+        sprites->textures[sprites->groups++] = texture;
+    }
+
+    sprites->group[sprites->count] = g;
+    sprites->instances[sprites->count] = *sprite;
+    sprites->count++;
+}
+
+void
+sprites_flush(struct FlappySprites* sprites)
+{
+    assert(sprites != NULL);
+    if (sprites->count == 0) return;
+
+    // bucket the instances by texture so each one is a contiguous range
+    long first[SPRITES_TEXTURES + 1] = { 0 };
+    for (long i = 0; i < sprites->count; i++) {
+        first[sprites->group[i] + 1]++;
+    }
+    for (long g = 0; g < sprites->groups; g++) {
+        first[g + 1] += first[g];
+    }
+
+    long next[SPRITES_TEXTURES];
+    memcpy(next, first, sizeof(next));
+    for (long i = 0; i < sprites->count; i++) {
+        sprites->sorted[next[sprites->group[i]]++] = sprites->instances[i];
+    }
+
+    // back to front within each texture, instances are drawn in order so
+    // blending is right without depth writes (the input is mostly sorted)
+    for (long g = 0; g < sprites->groups; g++) {
+        for (long i = first[g] + 1; i < first[g + 1]; i++) {
+            struct SpriteInstance sprite = sprites->sorted[i];
+            long j = i;
+            while (j > first[g] && sprites->sorted[j - 1].z > sprite.z) {
+                sprites->sorted[j] = sprites->sorted[j - 1];
+                j--;
+            }
+            sprites->sorted[j] = sprite;
+        }
+    }
+
+    glstate_use_program(sprites->shader);
+    glstate_bind_vertex_array(sprites->vao);
+
+    // respecifying the whole buffer lets the driver hand out fresh storage
+    // instead of waiting for the GPU to finish with the last flush
+    glstate_bind_buffer(GL_ARRAY_BUFFER, sprites->instance_buffer);
+    glBufferData(GL_ARRAY_BUFFER, sprites->count * sizeof(struct SpriteInstance), sprites->sorted, GL_STREAM_DRAW);
+
+    for (long g = 0; g < sprites->groups; g++) {
+        if (g > 0) sprites_attribs(first[g]);
+        glstate_bind_texture(0, sprites->textures[g]);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, sprites->vertex_count, first[g + 1] - first[g]);
+    }
+
+    // leave the attributes pointing at the start for the next flush
+    if (sprites->groups > 1) sprites_attribs(0);
+
+    sprites->count = 0;
+    sprites->groups = 0;
+}
@@ -0,0 +1,54 @@
+#ifndef FLAPPY_SPRITES_H_INCLUDED
+#define FLAPPY_SPRITES_H_INCLUDED
+
+#include <stdbool.h>
+
+// Instanced sprite renderer. Sprites added between sprites_begin and
+// sprites_flush are collected into one instance buffer and drawn with a
+// single glDrawArraysInstanced per texture, in the order each texture was
+// first used. Within a texture instances are drawn back to front by z, so
+// overlapping sprites blend correctly with or without a depth buffer.
+// The projection comes from the shared Frame uniform block (frame.h).
+
+enum {
+    SPRITES_CAPACITY = 256,  // instances per flush, adding more flushes early
+    SPRITES_TEXTURES = 8,    // distinct textures per flush
+};
+
+struct SpriteInstance {
+    float x;
+    float y;
+    float z;  // layer
+    float rotation;  // radians
+    float scale_x;
+    float scale_y;
+    float u0;  // texcoord rect within the texture
+    float v0;
+    float u1;
+    float v1;
+};
+
+struct FlappySprites {
+    unsigned int shader;
+    unsigned int vao;
+    unsigned int instance_buffer;
+    long vertex_count;
+
+    // frame being collected
+    long count;
+    long groups;
+    unsigned int textures[SPRITES_TEXTURES];
+    unsigned char group[SPRITES_CAPACITY];
+    struct SpriteInstance instances[SPRITES_CAPACITY];
+    struct SpriteInstance sorted[SPRITES_CAPACITY];
+};
+
+// model_buffer is a MODEL_FORMAT_T2F_V3F quad centered on the origin
+bool sprites_create(struct FlappySprites* sprites, unsigned int model_buffer, long vertex_count);
+void sprites_destroy(struct FlappySprites* sprites);
+
+void sprites_begin(struct FlappySprites* sprites);
+void sprites_add(struct FlappySprites* sprites, unsigned int texture, const struct SpriteInstance* sprite);
+void sprites_flush(struct FlappySprites* sprites);
+
+#endif
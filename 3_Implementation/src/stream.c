@@ -0,0 +1,85 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glstate.h"
+#include "opengl.h"
+#include "stream.h"
+
+bool
+stream_create(struct FlappyStream* stream, long capacity, long components)
+{
+    assert(stream != NULL);
+    assert(capacity > 0);
+    assert(components > 0);
+
+    memset(stream, 0, sizeof(*stream));
+    stream->capacity = capacity;
+    stream->stride = components * sizeof(float);
+
+    glGenVertexArrays(1, &stream->vao);
+    glGenBuffers(1, &stream->vbo);
+    if (stream->vao == 0 || stream->vbo == 0) {
+        fprintf(stderr, "failed to create stream buffer\n");
+        return false;
+    }
+
+    glstate_bind_vertex_array(stream->vao);
+    glstate_bind_buffer(GL_ARRAY_BUFFER, stream->vbo);
+    glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+    glVertexAttribPointer(0, components, GL_FLOAT, GL_FALSE, stream->stride, (void*)0);
+    glEnableVertexAttribArray(0);
+    glstate_bind_vertex_array(0);
+    return true;
+}
+
+void
+stream_destroy(struct FlappyStream* stream)
+{
+    assert(stream != NULL);
+
+    glstate_forget();
+    glDeleteBuffers(1, &stream->vbo);
+    glDeleteVertexArrays(1, &stream->vao);
+}
+
+float*
+stream_map(struct FlappyStream* stream, long size, long* first)
+{
+    assert(stream != NULL);
+    assert(first != NULL);
+    assert(size > 0 && size <= stream->capacity);
+
+    glstate_bind_vertex_array(stream->vao);
+    glstate_bind_buffer(GL_ARRAY_BUFFER, stream->vbo);
+
+    // start on a whole vertex so the offset is a valid first index
+    long offset = (stream->offset + stream->stride - 1) / stream->stride * stream->stride;
+    unsigned int access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    if (offset + size > stream->capacity) {
+        offset = 0;
+        access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT;
+        stream->orphans++;
+    }
+
+    void* data = glMapBufferRange(GL_ARRAY_BUFFER, offset, size, access);
+    if (data == NULL) {
+        fprintf(stderr, "failed to map stream buffer\n");
+        return NULL;
+    }
+
+    stream->offset = offset + size;
+    *first = offset / stream->stride;
+    return data;
+}
+
+void
+stream_unmap(struct FlappyStream* stream)
+{
+    assert(stream != NULL);
+
+    glstate_bind_buffer(GL_ARRAY_BUFFER, stream->vbo);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+}
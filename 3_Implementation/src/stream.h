@@ -0,0 +1,29 @@
+#ifndef FLAPPY_STREAM_H_INCLUDED
+#define FLAPPY_STREAM_H_INCLUDED
+
+#include <stdbool.h>
+
+// Streaming vertex buffer for geometry rebuilt every frame. Writes are
+// appended to one buffer with a fixed VAO (float vertices on attribute 0).
+// Appended ranges are mapped unsynchronized, which is safe because nothing
+// already handed to the GPU is written again: when the buffer is full its
+// storage is orphaned and writing starts over at the front.
+
+struct FlappyStream {
+    unsigned int vbo;
+    unsigned int vao;
+    long capacity;  // bytes
+    long stride;    // bytes per vertex
+    long offset;    // next free byte
+    long orphans;   // times the storage was replaced
+};
+
+bool stream_create(struct FlappyStream* stream, long capacity, long components);
+void stream_destroy(struct FlappyStream* stream);
+
+// map room for size bytes and return where to write them, first is set to
+// the index of the first vertex for glDrawArrays, the VAO stays bound
+float* stream_map(struct FlappyStream* stream, long size, long* first);
+void stream_unmap(struct FlappyStream* stream);
+
+#endif
@@ -1,10 +1,32 @@
 #include "unity.h"
+#include <string.h>
+
+#include <batch.h>
+#include <config.h>
+#include <gldebug.h>
+#include <glnull.h>
+#include <glstate.h>
 #include <play.h>
+#include <pool.h>
+#include <replay.h>
+#include <sim.h>
+#include <timing.h>
 
 #define PROJECT_NAME    "Flappy Bird"
 
 void test_update(void);
 void test_reset(void);
+void test_flap(void);
+void test_fixed_step(void);
+void test_batch(void);
+void test_pool(void);
+void test_gap(void);
+void test_replay(void);
+void test_snapshot(void);
+void test_timing(void);
+void test_gldebug_classify(void);
+void test_glstate_null(void);
+void test_render_null(void);
 
 void setUp(){}
 
@@ -17,130 +39,470 @@ int main()
 
   RUN_TEST(test_update);
   RUN_TEST(test_reset);
+  RUN_TEST(test_flap);
+  RUN_TEST(test_fixed_step);
+  RUN_TEST(test_batch);
+  RUN_TEST(test_pool);
+  RUN_TEST(test_gap);
+  RUN_TEST(test_replay);
+  RUN_TEST(test_snapshot);
+  RUN_TEST(test_timing);
+  RUN_TEST(test_gldebug_classify);
+  RUN_TEST(test_glstate_null);
+  RUN_TEST(test_render_null);
 
   return UNITY_END();
 }
 
 void test_update(void) {
 	
+	struct FlappySim game;
+	sim_reset(&game, 1);
+	struct FlappySim lgame=game;
+	
+	struct FlappyInput input = { 0 };
+	sim_step(&game, &input, 0.63);
+	TEST_ASSERT_EQUAL(lgame.game_over, game.game_over);
+}
+
+void test_reset(void) {
+	
+	struct FlappySim game;
+	sim_reset(&game, 1);
+	game.game_over=true;
+	sim_reset(&game, 1);
+	TEST_ASSERT_EQUAL(false,game.game_over);
+}
+
+void test_flap(void) {
+	
+	struct FlappySim game;
+	sim_reset(&game, 1);
+	
+	// holding the flap key only flaps once
+	struct FlappyInput input = { .flap = true };
+	sim_step(&game, &input, 0.01);
+	TEST_ASSERT_TRUE(game.playing);
+	TEST_ASSERT_EQUAL_FLOAT(FLAP, game.bird_vel_y);
+	float held = game.bird_vel_y;
+	sim_step(&game, &input, 0.01);
+	TEST_ASSERT_TRUE(game.bird_vel_y < held);
+}
+
+void test_fixed_step(void) {
+	
+	// a power of two step keeps the accumulator exact
+	const double step = 1.0 / 128.0;
 	
-	if (!glfwInit()) {
-		const char* error = NULL;
-		glfwGetError(&error);
-		fprintf(stderr, "failed to init GLFW3: %s\n", error);
-		assert(0==1);
+	struct FlappyBoard game = { 0 };
+	game.step = step;
+	rst_gme(&game, 4);
+	
+	struct FlappySim steps;
+	sim_reset(&steps, 4);
+	struct FlappyInput input = { .flap = true };
+	
+	// 2.5 steps of frame time run two whole steps and keep half of one
+	input_gme(&game, &input, step * 2.5);
+	for (long s = 0; s < 2; s++) sim_step(&steps, &input, step);
+	TEST_ASSERT_EQUAL_MEMORY(&steps.bird_pos_x, &game.sim.bird_pos_x, sizeof(float));
+	TEST_ASSERT_EQUAL_MEMORY(&steps.bird_pos_y, &game.sim.bird_pos_y, sizeof(float));
+	TEST_ASSERT_EQUAL_FLOAT(0.5f, game.alpha);
+	
+	// the leftover half and a quarter make one more step
+	input_gme(&game, &input, step * 0.75);
+	sim_step(&steps, &input, step);
+	TEST_ASSERT_EQUAL_MEMORY(&steps.bird_pos_x, &game.sim.bird_pos_x, sizeof(float));
+	TEST_ASSERT_EQUAL_FLOAT(0.25f, game.alpha);
+	
+	// rendering blends from the previous step towards the current one
+	struct FlappySim previous = steps;
+	input_gme(&game, &input, step);
+	sim_step(&steps, &input, step);
+	TEST_ASSERT_EQUAL_MEMORY(&previous.bird_pos_x, &game.prev_bird_pos_x, sizeof(float));
+	TEST_ASSERT_EQUAL_MEMORY(&previous.camera, &game.prev_camera, sizeof(float));
+	TEST_ASSERT_EQUAL_MEMORY(&steps.bird_pos_x, &game.sim.bird_pos_x, sizeof(float));
+	TEST_ASSERT_EQUAL_FLOAT(0.25f, game.alpha);
+	
+	// a long hitch only runs STEP_LIMIT worth of steps
+	rst_gme(&game, 4);
+	sim_reset(&steps, 4);
+	input_gme(&game, &input, 10.0);
+	for (long s = 0; s < STEP_LIMIT / step; s++) sim_step(&steps, &input, step);
+	TEST_ASSERT_EQUAL_MEMORY(&steps.bird_pos_x, &game.sim.bird_pos_x, sizeof(float));
+	TEST_ASSERT_EQUAL_MEMORY(&steps.bird_pos_y, &game.sim.bird_pos_y, sizeof(float));
+	TEST_ASSERT_EQUAL_FLOAT(0.0f, game.alpha);
+	
+	// a step that restarts the game doesn't blend back from the old run
+	game.sim.bird_pos_x = 100.0f;
+	game.sim.camera = 100.0f;
+	game.sim.game_over = true;
+	struct FlappyInput release = { .flap = false };
+	input_gme(&game, &release, step);
+	input_gme(&game, &input, step * 1.5);
+	TEST_ASSERT_FALSE(game.sim.game_over);
+	TEST_ASSERT_TRUE(game.sim.bird_pos_x < 100.0f);
+	TEST_ASSERT_EQUAL_MEMORY(&game.sim.bird_pos_x, &game.prev_bird_pos_x, sizeof(float));
+	TEST_ASSERT_EQUAL_MEMORY(&game.sim.camera, &game.prev_camera, sizeof(float));
+	TEST_ASSERT_EQUAL_FLOAT(0.5f, game.alpha);
+}
+
+void test_batch(void) {
+	
+	// odd count so both the vector kernel and the scalar tail run
+	enum { BIRDS = 13, STEPS = 2000 };
+	
+	struct FlappyBatch batch;
+	TEST_ASSERT_TRUE(batch_create(&batch, BIRDS));
+	
+	batch_reset(&batch, 42);
+	
+	struct FlappySim games[BIRDS];
+	for (long b = 0; b < BIRDS; b++) {
+		sim_reset(&games[b], 42);
 	}
 	
-	glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
-	
-	// ask for an OpenGL 3.3 Core profile
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
-	
-	// set flags for monitor details
-	GLFWmonitor* monitor = glfwGetPrimaryMonitor();
-	const GLFWvidmode* mode = glfwGetVideoMode(monitor);
-	glfwWindowHint(GLFW_RED_BITS, mode->redBits);
-	glfwWindowHint(GLFW_GREEN_BITS, mode->greenBits);
-	glfwWindowHint(GLFW_BLUE_BITS, mode->blueBits);
-	glfwWindowHint(GLFW_REFRESH_RATE, mode->refreshRate);
-	
-	GLFWwindow* window = NULL;
-	
-		window = glfwCreateWindow(1280, 720, "Flappy Bird", NULL, NULL);
-		if (window == NULL) {
-			const char* error = NULL;
-			glfwGetError(&error);
-			fprintf(stderr, "failed to create GLFW3 window: %s\n", error);
-			
-			glfwTerminate();
-			assert(0==1);
+	unsigned char flap[BIRDS];
+	for (long s = 0; s < STEPS; s++) {
+		for (long b = 0; b < BIRDS; b++) {
+			// every bird flaps on its own rhythm, restarting when it dies
+			flap[b] = (s % (20 + b * 3)) < 2;
+			struct FlappyInput input = { .flap = flap[b] };
+			sim_step(&games[b], &input, 1.0 / 120.0);
+		}
+		batch_step(&batch, flap, 1.0 / 120.0);
+		
+		for (long b = 0; b < BIRDS; b++) {
+			TEST_ASSERT_EQUAL_MEMORY(&games[b].bird_pos_x, &batch.bird_pos_x[b], sizeof(float));
+			TEST_ASSERT_EQUAL_MEMORY(&games[b].bird_pos_y, &batch.bird_pos_y[b], sizeof(float));
+			TEST_ASSERT_EQUAL_MEMORY(&games[b].bird_vel_y, &batch.bird_vel_y[b], sizeof(float));
+			TEST_ASSERT_EQUAL_MEMORY(&games[b].camera, &batch.camera[b], sizeof(float));
+			TEST_ASSERT_EQUAL(games[b].game_over, batch.game_over[b]);
+			TEST_ASSERT_EQUAL(games[b].score, batch.score[b]);
+			TEST_ASSERT_EQUAL(games[b].seed, batch.seed[b]);
 		}
-	
-	struct FlappyBoard game;
-	game.f_s = 3;
-	game.f_s_uniform_layer = 0;
-	game.f_s_uniform_model = 1; 
-	game.f_s_uniform_projection = 2;
-	game.s_s = 6;
-	game.s_s_uniform_model = 0;
-	game.s_s_uniform_projection = 1;
-	game.s_b = 1;
-	game.s_m = 1;
-	game.s_m_vertex_count = 6;
-	game.t_bg = 1;
-	game.t_bird = 2;
-	game.t_pipebottom = 3;
-	game.t_pipetop = 4;
-	game.l_sec = 0;
-	game.l_frme = 0, 
-	game.num_frame = 0;
-	game.playing = false;
-	game.game_over = false;
-	game.space = false;
-	game.score = 0;
-	game.camera = -3;
-	game.bird_pos_x = -6; 
-	game.bird_pos_y = 0; 
-	game.bird_vel_x = 6; game.bird_vel_y = 0;
-	for (long i = 0; i < NUMPIPE; i++) {
-		float gap = (float)rand() / (float)RAND_MAX;  // [0.0, 1.0]
-		gap -= 0.5f;  // [-0.5, 0.5]
-		game.pipes[i] = gap * 4.0f;  // [-2.0, 2.0]
 	}
-	struct FlappyBoard lgame=game;
-	// timing vars
-	long num_frame = 0;
-change_gme(&game, window, 0.63);
-  TEST_ASSERT_EQUAL(lgame.game_over, game.game_over);
+	
+	batch_destroy(&batch);
 }
 
-void test_reset(void) {
-		
-		
-	struct FlappyBoard game;
-	game.f_s = 3;
-	game.f_s_uniform_layer = 0;
-	game.f_s_uniform_model = 1; 
-	game.f_s_uniform_projection = 2;
-	game.s_s = 6;
-	game.s_s_uniform_model = 0;
-	game.s_s_uniform_projection = 1;
-	game.s_b = 1;
-	game.s_m = 1;
-	game.s_m_vertex_count = 6;
-	game.t_bg = 1;
-	game.t_bird = 2;
-	game.t_pipebottom = 3;
-	game.t_pipetop = 4;
-	game.l_sec = 0;
-	game.l_frme = 0, 
-	game.num_frame = 0;
-	game.playing = false;
-	game.game_over = false;
-	game.space = false;
-	game.score = 0;
-	game.camera = -3;
-	game.bird_pos_x = -6; 
-	game.bird_pos_y = 0; 
-	game.bird_vel_x = 6; game.bird_vel_y = 0;
-	for (long i = 0; i < NUMPIPE; i++) {
-		float gap = (float)rand() / (float)RAND_MAX;  // [0.0, 1.0]
-		gap -= 0.5f;  // [-0.5, 0.5]
-		game.pipes[i] = gap * 4.0f;  // [-2.0, 2.0]
+void test_pool(void) {
+	
+	// more games than one chunk per thread so stealing kicks in
+	enum { GAMES = 300, THREADS = 3, SKIP = 2, STEPS = 400 };
+	
+	struct FlappyPool* pool = pool_create(GAMES, THREADS, SKIP);
+	TEST_ASSERT_NOT_NULL(pool);
+	
+	static struct FlappySim games[GAMES];
+	static float obs[GAMES * POOL_OBS];
+	static float reward[GAMES];
+	static unsigned char done[GAMES];
+	static unsigned char actions[GAMES];
+	for (long g = 0; g < GAMES; g++) {
+		games[g] = *pool_game(pool, g);
 	}
-		struct FlappyBoard lgame=game;
-		// timing vars
-		long num_frame = 0;
-		game.game_over=true;
-		rst_gme(&game);
-		TEST_ASSERT_EQUAL(false,game.game_over);
-		
-		
+	
+	for (long s = 0; s < STEPS; s++) {
+		for (long g = 0; g < GAMES; g++) {
+			actions[g] = (s % (8 + g % 13)) == 0;
+		}
+		pool_step(pool, actions, obs, reward, done);
 		
+		// the pool must match stepping each game on its own
+		for (long g = 0; g < GAMES; g++) {
+			if (!games[g].game_over) {
+				for (long k = 0; k < SKIP; k++) {
+					struct FlappyInput input = { .flap = actions[g] && k == 0 };
+					sim_step(&games[g], &input, 1.0 / STEP_RATE);
+					if (games[g].game_over) break;
+				}
+			}
+			const struct FlappySim* game = pool_game(pool, g);
+			TEST_ASSERT_EQUAL_FLOAT(games[g].bird_pos_x, game->bird_pos_x);
+			TEST_ASSERT_EQUAL_FLOAT(games[g].bird_pos_y, game->bird_pos_y);
+			TEST_ASSERT_EQUAL_FLOAT(games[g].bird_pos_y, obs[g * POOL_OBS + 0]);
+			TEST_ASSERT_EQUAL(games[g].game_over, done[g]);
+		}
 		
+		// restart every finished game now and then
+		if (s % 50 == 49) {
+			long ids[GAMES];
+			long count = 0;
+			for (long g = 0; g < GAMES; g++) {
+				if (done[g]) ids[count++] = g;
+			}
+			pool_reset(pool, ids, count, obs);
+			for (long i = 0; i < count; i++) {
+				games[ids[i]] = *pool_game(pool, ids[i]);
+				TEST_ASSERT_FALSE(pool_game(pool, ids[i])->game_over);
+			}
+		}
+	}
+	
+	struct FlappyPoolStats stats;
+	pool_stats(pool, &stats);
+	TEST_ASSERT_EQUAL(THREADS, stats.threads);
+	TEST_ASSERT_TRUE(stats.steps > 0);
+	
+	pool_destroy(pool);
+}
 
- 
+void test_gap(void) {
+	
+	enum { PIPES = 4096 };
+	
+	struct FlappySim game;
+	sim_reset(&game, 7);
+	
+	// levels are a pure function of (seed, index) and never repeat
+	int differ = 0;
+	int repeat = 0;
+	for (long i = 0; i < PIPES; i++) {
+		TEST_ASSERT_EQUAL_FLOAT(sim_gap(7, i), sim_pipe(&game, i));
+		TEST_ASSERT_TRUE(sim_gap(7, i) >= -2.0f && sim_gap(7, i) < 2.0f);
+		differ += sim_gap(7, i) != sim_gap(8, i);
+		repeat += i >= 512 && sim_gap(7, i) == sim_gap(7, i - 512);
+	}
+	TEST_ASSERT_TRUE(differ > PIPES / 2);
+	TEST_ASSERT_TRUE(repeat < PIPES / 2);
+	
+	// the ring follows the camera
+	game.camera = 5000.0f;
+	struct FlappyInput idle = { .flap = false };
+	sim_step(&game, &idle, 0.01);
+	TEST_ASSERT_TRUE(game.pipe_base > 1000);
+	for (long i = game.pipe_base; i < game.pipe_base + PIPE_WINDOW; i++) {
+		TEST_ASSERT_EQUAL_FLOAT(sim_gap(7, i), game.pipes[i % PIPE_WINDOW]);
+	}
+	
+	// restarting moves on to the next level
+	game.game_over = true;
+	struct FlappyInput input = { .flap = true };
+	sim_step(&game, &input, 0.01);
+	TEST_ASSERT_EQUAL(8, game.seed);
+	TEST_ASSERT_EQUAL(0, game.pipe_base);
+}
+
+void test_replay(void) {
+	
+	enum { STEPS = 20000 };
+	
+	struct FlappyRecorder rec;
+	replay_recorder_init(&rec);
+	
+	// a long session: the bird dies and restarts many times
+	struct FlappySim game;
+	sim_reset(&game, 99);
+	long restarts = 0;
+	for (long s = 0; s < STEPS; s++) {
+		struct FlappyInput input = { .flap = (s % 37) < 3 || (s % 101) == 50 };
+		restarts += input.flap && game.game_over;
+		replay_record(&rec, &game, input.flap, 1.0 / STEP_RATE);
+		sim_step(&game, &input, 1.0 / STEP_RATE);
+	}
+	replay_finish(&rec, &game);
+	TEST_ASSERT_TRUE(restarts > 0);
+	
+	struct FlappyReplayStats stats;
+	TEST_ASSERT_TRUE(replay_play(rec.data, rec.size, &stats));
+	TEST_ASSERT_EQUAL(restarts + 1, stats.runs);
+	TEST_ASSERT_EQUAL(STEPS, stats.frames);
+	TEST_ASSERT_EQUAL(0, stats.mismatches);
+	
+	// a tampered log no longer reproduces its scores
+	// (magic 0-4, seed 5, 5-byte step 6-10, first score at 11)
+	rec.data[11] ^= 1;
+	TEST_ASSERT_TRUE(replay_play(rec.data, rec.size, &stats));
+	TEST_ASSERT_TRUE(stats.mismatches > 0);
+	
+	replay_recorder_free(&rec);
+	
+	// corrupt logs fail fast instead of stepping (nearly) forever:
+	// seed 0, step 1.0f or +inf, score 0, then the step count and runs
+	static const unsigned char huge_count[] = {
+		'F', 'L', 'P', 'R', 2, 0, 0x80, 0x80, 0x80, 0xfc, 0x03, 0,
+		0x80, 0x80, 0x80, 0x80, 0x80, 0x20,
+	};
+	static const unsigned char wrapping_run[] = {
+		'F', 'L', 'P', 'R', 2, 0, 0x80, 0x80, 0x80, 0xfc, 0x03, 0,
+		10, 5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+	};
+	static const unsigned char infinite_step[] = {
+		'F', 'L', 'P', 'R', 2, 0, 0x80, 0x80, 0x80, 0xfc, 0x07, 0, 1, 1,
+	};
+	TEST_ASSERT_FALSE(replay_play(huge_count, sizeof(huge_count), &stats));
+	TEST_ASSERT_FALSE(replay_play(wrapping_run, sizeof(wrapping_run), &stats));
+	TEST_ASSERT_FALSE(replay_play(infinite_step, sizeof(infinite_step), &stats));
+}
+
+void test_snapshot(void) {
+	
+	TEST_ASSERT_TRUE(sizeof(struct FlappySnapshot) <= 32);
+	
+	struct FlappySim game;
+	sim_reset(&game, 3);
+	for (long s = 0; s < 500; s++) {
+		struct FlappyInput input = { .flap = (s % 30) == 0 };
+		sim_step(&game, &input, 1.0 / STEP_RATE);
+	}
+	
+	struct FlappySnapshot snap;
+	flappy_snapshot(&game, &snap);
+	struct FlappySim before = game;
+	
+	// play on, then roll back and play the same inputs again
+	struct FlappySim ahead = game;
+	for (long s = 0; s < 300; s++) {
+		struct FlappyInput input = { .flap = (s % 25) == 0 };
+		sim_step(&ahead, &input, 1.0 / STEP_RATE);
+	}
+	
+	struct FlappySim again;
+	sim_reset(&again, 12345);
+	flappy_restore(&again, &snap);
+	TEST_ASSERT_EQUAL_FLOAT(before.bird_pos_x, again.bird_pos_x);
+	TEST_ASSERT_EQUAL_FLOAT(sim_pipe(&before, 40), sim_pipe(&again, 40));
+	for (long s = 0; s < 300; s++) {
+		struct FlappyInput input = { .flap = (s % 25) == 0 };
+		sim_step(&again, &input, 1.0 / STEP_RATE);
+	}
+	
+	TEST_ASSERT_EQUAL_MEMORY(&ahead.bird_pos_x, &again.bird_pos_x, sizeof(float));
+	TEST_ASSERT_EQUAL_MEMORY(&ahead.bird_pos_y, &again.bird_pos_y, sizeof(float));
+	TEST_ASSERT_EQUAL(ahead.game_over, again.game_over);
+	TEST_ASSERT_EQUAL(ahead.score, again.score);
+	TEST_ASSERT_EQUAL(ahead.pipe_base, again.pipe_base);
+	TEST_ASSERT_EQUAL_MEMORY(ahead.pipes, again.pipes, sizeof(ahead.pipes));
+}
+
+void test_timing(void) {
+	
+	static struct FlappyTiming timing;
+	timing_init(&timing, 0.0);
+	
+	// frame i takes i + 1 ms, split evenly over the four phases
+	double now = 0.0;
+	for (long i = 0; i < TIMING_FRAMES + 1000; i++) {
+		double phase = (i % 1000 + 1) / 4000.0;
+		for (int series = 0; series < TIMING_TOTAL; series++) {
+			now += phase;
+			timing_mark(&timing, series, now);
+		}
+		timing_end_frame(&timing);
+	}
+	TEST_ASSERT_EQUAL(TIMING_FRAMES + 1000, timing.count);
+	
+	// the newest 1000 frames are exactly 1..1000 ms
+	struct FlappyTimingReport report;
+	timing_report(&timing, TIMING_TOTAL, 1000, &report);
+	TEST_ASSERT_EQUAL(1000, report.frames);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 500.0f, report.p50);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 900.0f, report.p90);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 990.0f, report.p99);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 999.0f, report.p999);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 1000.0f, report.max);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 24.0f, timing.frames[(timing.count - 1) % TIMING_FRAMES].ms[TIMING_SIM]);
+	
+	// 0.25 ms buckets doubling: 1 ms is in [1, 2), 256 ms and up share the last
+	TEST_ASSERT_EQUAL(0, report.histogram[0]);
+	TEST_ASSERT_EQUAL(1, report.histogram[3]);
+	TEST_ASSERT_EQUAL(2, report.histogram[4]);
+	TEST_ASSERT_EQUAL(1000 - 255, report.histogram[TIMING_BUCKETS - 1]);
+	
+	// asking for more than the ring holds reports what is kept
+	timing_report(&timing, TIMING_TOTAL, 0, &report);
+	TEST_ASSERT_EQUAL(TIMING_FRAMES, report.frames);
+	
+	// skipped time is in neither a phase nor the frame
+	now += 0.5;
+	timing_skip(&timing, now);
+	now += 0.001;
+	timing_mark(&timing, TIMING_SIM, now);
+	timing_end_frame(&timing);
+	struct FlappyFrameTime* last = &timing.frames[(timing.count - 1) % TIMING_FRAMES];
+	TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, last->ms[TIMING_SIM]);
+	TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, last->ms[TIMING_TOTAL]);
+}
+
+void test_gldebug_classify(void) {
+	
+	// keywords are checked recompile, then reallocation, then sync
+	TEST_ASSERT_EQUAL(GLDEBUG_RECOMPILE, gldebug_classify(GL_DEBUG_TYPE_PERFORMANCE,
+		"Fragment shader recompiled due to state change to avoid a stall"));
+	TEST_ASSERT_EQUAL(GLDEBUG_REALLOC, gldebug_classify(GL_DEBUG_TYPE_PERFORMANCE,
+		"Buffer reallocated, forcing a sync"));
+	TEST_ASSERT_EQUAL(GLDEBUG_SYNC, gldebug_classify(GL_DEBUG_TYPE_PERFORMANCE,
+		"glMapBufferRange STALLED waiting for the GPU"));
+	TEST_ASSERT_EQUAL(GLDEBUG_PERFORMANCE, gldebug_classify(GL_DEBUG_TYPE_PERFORMANCE,
+		"Using a slow path for this format"));
+	
+	// only performance messages are looked at
+	TEST_ASSERT_EQUAL(GLDEBUG_OTHER, gldebug_classify(GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR,
+		"Buffer reallocated"));
+	TEST_ASSERT_EQUAL(GLDEBUG_ERROR, gldebug_classify(GL_DEBUG_TYPE_ERROR,
+		"GL_INVALID_OPERATION in glDrawArrays, recompiling"));
+}
+
+void test_glstate_null(void) {
+	
+	struct FlappyGLNull gl;
+	TEST_ASSERT_TRUE(glnull_load(&gl, 64));
+	glstate_forget();
+	
+	// only changes reach GL
+	glstate_use_program(3);
+	glstate_use_program(3);
+	glstate_bind_texture(0, 7);
+	glstate_bind_texture(1, 7);
+	glstate_bind_texture(1, 7);
+	glstate_use_program(4);
+	TEST_ASSERT_EQUAL(2, glnull_count(&gl, "glUseProgram"));
+	TEST_ASSERT_EQUAL(2, glnull_count(&gl, "glBindTexture"));
+	TEST_ASSERT_EQUAL(2, glnull_count(&gl, "glActiveTexture"));
+	
+	long bind = glnull_find(&gl, 0, "glUseProgram");
+	TEST_ASSERT_EQUAL_FLOAT(3.0f, gl.calls[bind].args[0]);
+	bind = glnull_find(&gl, bind + 1, "glUseProgram");
+	TEST_ASSERT_EQUAL_FLOAT(4.0f, gl.calls[bind].args[0]);
+	TEST_ASSERT_EQUAL(0, gl.dropped);
+	
+	glnull_unload(&gl);
+}
+
+void test_render_null(void) {
+	
+	struct FlappyGLNull gl;
+	TEST_ASSERT_TRUE(glnull_load(&gl, 4096));
+	glstate_forget();
+	
+	struct FlappyBoard game = { 0 };
+	TEST_ASSERT_TRUE(start_game(&game, 5));
+	
+	// background, pipes and bird, score: three draws
+	glnull_clear(&gl);
+	game_render(&game, 640, 360, 0.5);
+	TEST_ASSERT_EQUAL(1, glnull_count(&gl, "glDrawArrays"));
+	TEST_ASSERT_EQUAL(2, glnull_count(&gl, "glDrawArraysInstanced"));
+	
+	// opaque front to back (score, then background), then blended sprites
+	// with depth writes off
+	long score = glnull_find(&gl, 0, "glDrawArraysInstanced");
+	long background = glnull_find(&gl, 0, "glDrawArrays");
+	long blend = glnull_find(&gl, 0, "glDepthMask");
+	blend = glnull_find(&gl, blend + 1, "glDepthMask");
+	long sprites = glnull_find(&gl, score + 1, "glDrawArraysInstanced");
+	TEST_ASSERT_TRUE(score < background);
+	TEST_ASSERT_TRUE(background < blend);
+	TEST_ASSERT_TRUE(blend < sprites);
+	TEST_ASSERT_EQUAL_FLOAT(0.0f, gl.calls[blend].args[0]);
+	
+	// the score didn't change, so its label isn't rebuilt
+	glnull_clear(&gl);
+	game_render(&game, 640, 360, 0.5);
+	TEST_ASSERT_EQUAL(0, glnull_count(&gl, "glMapBufferRange"));
+	TEST_ASSERT_EQUAL(3, glnull_count(&gl, "glDrawArrays") + glnull_count(&gl, "glDrawArraysInstanced"));
+	
+	end_game(&game);
+	glnull_unload(&gl);
 }
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "glstate.h"
 #include "opengl.h"
 #include "texture.h"
 
@@ -23,13 +24,13 @@ texture_create(int format, long width, long height, const unsigned char* pixels)
     unsigned int tex;
     glGenTextures(1, &tex);
 
-    glBindTexture(GL_TEXTURE_2D, tex);
+    glstate_bind_texture(0, tex);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    glstate_bind_texture(0, 0);
 
     return tex;
 }
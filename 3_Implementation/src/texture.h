@@ -1,12 +1,32 @@
 #ifndef FLAPPY_TEXTURE_H_INCLUDED
 #define FLAPPY_TEXTURE_H_INCLUDED
 
+#include <stdbool.h>
+
 enum texture_format {
     TEXTURE_FORMAT_UNDEFINED = 0,
     TEXTURE_FORMAT_RGB,
     TEXTURE_FORMAT_RGBA,
 };
 
+// Texcoord rect of one image inside a texture atlas. A flipped image has
+// u0 > u1 or v0 > v1. Transparent borders are trimmed off, x0, y0, x1, y1
+// is the part of the image (0 to 1 from the bottom left) the rect holds.
+// A rotated image is stored a quarter turn clockwise, u runs down the image
+// and v along it. Atlas headers are generated by scripts/res2header.py
+// from an .atlas file and define one region per image.
+struct texture_region {
+    float u0;
+    float v0;
+    float u1;
+    float v1;
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    bool rotated;
+};
+
 unsigned int texture_create(int format, long width, long height, const unsigned char* pixels);
 
 #endif
@@ -0,0 +1,230 @@
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "timing.h"
+
+static const char* TIMING_NAMES[TIMING_SERIES] = {
+    [TIMING_SIM] = "sim",
+    [TIMING_RENDER] = "render",
+    [TIMING_SWAP] = "swap",
+    [TIMING_POLL] = "poll",
+    [TIMING_TOTAL] = "frame",
+};
+
+static const float TIMING_BUCKET_MS = 0.25f;  // upper edge of bucket 0
+
+static const char TIMING_BAR[] = "########################################";
+enum { TIMING_BAR_WIDTH = sizeof(TIMING_BAR) - 1 };
+
+void
+timing_init(struct FlappyTiming* timing, double now)
+{
+    assert(timing != NULL);
+
+    memset(timing, 0, sizeof(*timing));
+    timing->start = now;
+    timing->mark = now;
+}
+
+void
+timing_mark(struct FlappyTiming* timing, int series, double now)
+{
+    assert(timing != NULL);
+    assert(series >= 0 && series < TIMING_TOTAL);
+
+    timing->current.ms[series] += (now - timing->mark) * 1000.0;
+    timing->mark = now;
+}
+
+void
+timing_end_frame(struct FlappyTiming* timing)
+{
+    assert(timing != NULL);
+
+    timing->current.ms[TIMING_TOTAL] = (timing->mark - timing->start) * 1000.0;
+    timing->frames[timing->count % TIMING_FRAMES] = timing->current;
+    timing->count++;
+
+    memset(&timing->current, 0, sizeof(timing->current));
+    timing->start = timing->mark;
+}
+
+void
+timing_skip(struct FlappyTiming* timing, double now)
+{
+    assert(timing != NULL);
+
+    timing->start += now - timing->mark;
+    timing->mark = now;
+}
+
+static int
+timing_compare(const void* a, const void* b)
+{
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+static long
+timing_bucket(float ms)
+{
+    if (ms < TIMING_BUCKET_MS) return 0;
+
+    long bucket = 1 + (long)floorf(log2f(ms / TIMING_BUCKET_MS));
+    return bucket < TIMING_BUCKETS ? bucket : TIMING_BUCKETS - 1;
+}
+
+// nearest rank
+static float
+timing_percentile(const float* sorted, long count, double p)
+{
+    long rank = (long)ceil(p * count) - 1;
+    if (rank < 0) rank = 0;
+    if (rank >= count) rank = count - 1;
+    return sorted[rank];
+}
+
+void
+timing_report(struct FlappyTiming* timing, int series, long frames, struct FlappyTimingReport* report)
+{
+    assert(timing != NULL);
+    assert(series >= 0 && series < TIMING_SERIES);
+    assert(report != NULL);
+
+    long kept = timing->count < TIMING_FRAMES ? timing->count : TIMING_FRAMES;
+    if (frames <= 0 || frames > kept) frames = kept;
+
+    memset(report, 0, sizeof(*report));
+    report->frames = frames;
+    if (frames == 0) return;
+
+    for (long i = 0; i < frames; i++) {
+        long index = (timing->count - frames + i) % TIMING_FRAMES;
+        float ms = timing->frames[index].ms[series];
+        timing->sorted[i] = ms;
+        report->histogram[timing_bucket(ms)]++;
+    }
+    qsort(timing->sorted, frames, sizeof(float), timing_compare);
+
+    report->p50 = timing_percentile(timing->sorted, frames, 0.50);
+    report->p90 = timing_percentile(timing->sorted, frames, 0.90);
+    report->p99 = timing_percentile(timing->sorted, frames, 0.99);
+    report->p999 = timing_percentile(timing->sorted, frames, 0.999);
+    report->max = timing->sorted[frames - 1];
+}
+
+// one line of percentiles per series, report is left with the whole frame
+static void
+timing_print_series(struct FlappyTiming* timing, long frames, FILE* out, struct FlappyTimingReport* report)
+{
+    for (int series = 0; series < TIMING_SERIES; series++) {
+        timing_report(timing, series, frames, report);
+        fprintf(out, "%-7s p50 %7.3f  p90 %7.3f  p99 %7.3f  p99.9 %7.3f  max %7.3f ms\n",
+            TIMING_NAMES[series], report->p50, report->p90, report->p99, report->p999, report->max);
+    }
+}
+
+void
+timing_print(struct FlappyTiming* timing, FILE* out)
+{
+    assert(timing != NULL);
+    assert(out != NULL);
+
+    struct FlappyTimingReport report;
+    timing_print_series(timing, 0, out, &report);
+
+    long most = 1;
+    for (long b = 0; b < TIMING_BUCKETS; b++) {
+        if (report.histogram[b] > most) most = report.histogram[b];
+    }
+    for (long b = 0; b < TIMING_BUCKETS; b++) {
+        int bar = report.histogram[b] * TIMING_BAR_WIDTH / most;
+        if (b < TIMING_BUCKETS - 1) {
+            fprintf(out, "  <  %7.2f ms %7ld %.*s\n", TIMING_BUCKET_MS * (1 << b), report.histogram[b], bar, TIMING_BAR);
+        } else {
+            fprintf(out, "  >= %7.2f ms %7ld %.*s\n", TIMING_BUCKET_MS * (1 << (b - 1)), report.histogram[b], bar, TIMING_BAR);
+        }
+    }
+}
+
+void
+timing_print_recent(struct FlappyTiming* timing, long frames, FILE* out)
+{
+    assert(timing != NULL);
+    assert(out != NULL);
+
+    struct FlappyTimingReport report;
+    timing_print_series(timing, frames, out, &report);
+
+    // the whole frame's histogram on one line, bucket upper edges in ms
+    fprintf(out, "%-7s", "buckets");
+    for (long b = 0; b < TIMING_BUCKETS; b++) {
+        if (b < TIMING_BUCKETS - 1) {
+            fprintf(out, " <%g:%ld", TIMING_BUCKET_MS * (1 << b), report.histogram[b]);
+        } else {
+            fprintf(out, " >=%g:%ld", TIMING_BUCKET_MS * (1 << (b - 1)), report.histogram[b]);
+        }
+    }
+    fprintf(out, "\n");
+}
+
+bool
+timing_dump(const struct FlappyTiming* timing, const char* path)
+{
+    assert(timing != NULL);
+    assert(path != NULL);
+
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "failed to open timing file: %s\n", path);
+        return false;
+    }
+
+    size_t length = strlen(path);
+    bool json = length >= 5 && strcmp(path + length - 5, ".json") == 0;
+
+    long kept = timing->count < TIMING_FRAMES ? timing->count : TIMING_FRAMES;
+    long first = timing->count - kept;
+
+    if (json) {
+        fprintf(f, "{ \"frames\": [");
+    } else {
+        fprintf(f, "frame");
+        for (int series = 0; series < TIMING_SERIES; series++) {
+            fprintf(f, ",%s_ms", TIMING_NAMES[series]);
+        }
+        fprintf(f, "\n");
+    }
+
+    for (long i = first; i < timing->count; i++) {
+        const struct FlappyFrameTime* frame = &timing->frames[i % TIMING_FRAMES];
+        if (json) {
+            fprintf(f, "%s\n  { \"frame\": %ld", i > first ? "," : "", i);
+            for (int series = 0; series < TIMING_SERIES; series++) {
+                fprintf(f, ", \"%s_ms\": %.4f", TIMING_NAMES[series], frame->ms[series]);
+            }
+            fprintf(f, " }");
+        } else {
+            fprintf(f, "%ld", i);
+            for (int series = 0; series < TIMING_SERIES; series++) {
+                fprintf(f, ",%.4f", frame->ms[series]);
+            }
+            fprintf(f, "\n");
+        }
+    }
+
+    if (json) {
+        fprintf(f, "\n] }\n");
+    }
+
+    bool ok = fclose(f) == 0;
+    if (!ok) {
+        fprintf(stderr, "failed to write timing file: %s\n", path);
+    }
+    return ok;
+}
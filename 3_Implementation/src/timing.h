@@ -0,0 +1,76 @@
+#ifndef FLAPPY_TIMING_H_INCLUDED
+#define FLAPPY_TIMING_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// Per-frame timing. Each frame is split into phases that are closed off
+// with timing_mark as the main loop passes through them. Finished frames
+// go into a fixed ring of the last TIMING_FRAMES frames, so recording
+// never allocates. Times are stored in milliseconds.
+//
+// Reports give percentiles and a log-scale histogram (bucket 0 is under
+// 0.25 ms, each bucket after that doubles, the last one is open ended).
+
+enum {
+    TIMING_FRAMES = 4096,
+    TIMING_BUCKETS = 12,
+};
+
+enum timing_series {
+    TIMING_SIM = 0,
+    TIMING_RENDER,
+    TIMING_SWAP,
+    TIMING_POLL,
+    TIMING_TOTAL,  // whole frame, filled in by timing_end_frame
+    TIMING_SERIES,
+};
+
+struct FlappyFrameTime {
+    float ms[TIMING_SERIES];
+};
+
+struct FlappyTimingReport {
+    long frames;
+    float p50;
+    float p90;
+    float p99;
+    float p999;
+    float max;
+    long histogram[TIMING_BUCKETS];
+};
+
+struct FlappyTiming {
+    struct FlappyFrameTime frames[TIMING_FRAMES];
+    long count;  // frames ever finished, the newest is at (count - 1) % TIMING_FRAMES
+
+    // frame in progress
+    struct FlappyFrameTime current;
+    double start;
+    double mark;
+
+    // scratch space for sorting in timing_report
+    float sorted[TIMING_FRAMES];
+};
+
+void timing_init(struct FlappyTiming* timing, double now);
+
+// the given phase of the current frame ran until now
+void timing_mark(struct FlappyTiming* timing, int series, double now);
+void timing_end_frame(struct FlappyTiming* timing);
+// leave the time since the last mark out of every phase (the loop's own
+// reporting, which would otherwise land in the next frame)
+void timing_skip(struct FlappyTiming* timing, double now);
+
+// summarize the newest frames (0 or more than are kept means all of them)
+void timing_report(struct FlappyTiming* timing, int series, long frames, struct FlappyTimingReport* report);
+
+// every phase and the whole frame over all kept frames, with a bar chart
+void timing_print(struct FlappyTiming* timing, FILE* out);
+// the same over the newest frames, with the histogram on one line
+void timing_print_recent(struct FlappyTiming* timing, long frames, FILE* out);
+
+// write every kept frame as CSV, or as JSON if path ends in ".json"
+bool timing_dump(const struct FlappyTiming* timing, const char* path);
+
+#endif